@@ -0,0 +1,45 @@
+#pragma once
+
+/**
+ * @file bench/bench.hpp
+ * @brief Minimal timing helpers shared by the benchmarks
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <utility>
+
+namespace zuu::bench {
+
+// Keeps `value` observable so the measured work is not optimized away
+template <typename T>
+inline void do_not_optimize(T&& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+/**
+ * @brief Best-of-`reps` wall time of `fn()` in milliseconds
+ */
+template <typename Fn>
+double time_ms(Fn&& fn, int reps = 5) {
+    double best = 1e300;
+    for (int r = 0; r < reps; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        const auto stop = std::chrono::steady_clock::now();
+        const double ms = std::chrono::duration<double, std::milli>(stop - start).count();
+        if (ms < best) best = ms;
+    }
+    return best;
+}
+
+inline void report(const char* name, double ms, double baseline_ms) {
+    std::printf("  %-34s %9.2f ms   (%.2fx)\n", name, ms, baseline_ms / ms);
+}
+
+} // namespace zuu::bench
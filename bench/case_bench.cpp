@@ -0,0 +1,152 @@
+/**
+ * @file bench/case_bench.cpp
+ * @brief Vector ASCII case kernels vs. the per-character loops
+ *
+ * Lowercases 500k HTTP header names (fstring<64>) and 200k mixed-case
+ * identifiers (fstring<128>, char and char16_t), and compares header
+ * names case-insensitively. Baselines are the loops the stages used
+ * before: push_back of char_to_lower per character, and the scalar
+ * map loop the fused engine still runs during constant evaluation.
+ */
+
+#include <zuu/fstring.hpp>
+#include "bench.hpp"
+
+#include <cstdio>
+#include <random>
+#include <string_view>
+#include <vector>
+
+using namespace zuu;
+using namespace zuu::str;
+
+namespace {
+
+constexpr std::string_view header_names[] = {
+    "Content-Type", "Content-Length", "Accept-Encoding", "X-Forwarded-For",
+    "Cache-Control", "If-None-Match", "Authorization", "User-Agent",
+    "Access-Control-Allow-Origin", "Strict-Transport-Security", "Host",
+    "X-Request-Id", "Sec-WebSocket-Extensions", "Last-Modified",
+};
+
+template <meta::character CharT, std::size_t Cap>
+std::vector<basic_fstring<CharT, Cap>> make_headers(std::size_t count) {
+    std::mt19937_64 rng{42};
+    std::vector<basic_fstring<CharT, Cap>> out;
+    out.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::string_view name = header_names[rng() % std::size(header_names)];
+        basic_fstring<CharT, Cap> s;
+        for (char c : name) s.push_back(static_cast<CharT>(rng() % 3 == 0 ? char_to_upper(c) : c));
+        out.push_back(s);
+    }
+    return out;
+}
+
+template <meta::character CharT, std::size_t Cap>
+std::vector<basic_fstring<CharT, Cap>> make_identifiers(std::size_t count) {
+    std::mt19937_64 rng{7};
+    std::vector<basic_fstring<CharT, Cap>> out;
+    out.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        basic_fstring<CharT, Cap> s;
+        const std::size_t len = 24 + rng() % 80;
+        for (std::size_t k = 0; k < len; ++k) {
+            const unsigned r = rng() % 8;
+            s.push_back(static_cast<CharT>(r == 0 ? '_' : r < 3 ? 'A' + rng() % 26 : 'a' + rng() % 26));
+        }
+        out.push_back(s);
+    }
+    return out;
+}
+
+// Pre-kernel to_lower: one push_back (and terminator write) per character
+template <meta::character CharT, std::size_t Cap>
+basic_fstring<CharT, Cap> push_back_lower(const basic_fstring<CharT, Cap>& s) {
+    basic_fstring<CharT, Cap> r;
+    for (CharT c : s) r.push_back(char_to_lower(c));
+    return r;
+}
+
+// The scalar map loop with a single size update
+template <meta::character CharT, std::size_t Cap>
+basic_fstring<CharT, Cap> scalar_lower(const basic_fstring<CharT, Cap>& s) {
+    basic_fstring<CharT, Cap> r;
+    r.resize_and_overwrite(s.size(), [&](CharT* p, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) p[i] = char_to_lower(s[i]);
+        return n;
+    });
+    return r;
+}
+
+template <typename Str>
+void lower_case(const char* name, const std::vector<Str>& strs) {
+    std::size_t bytes = 0;
+    for (const auto& s : strs) bytes += s.size() * sizeof(s[0]);
+
+    std::size_t a = 0, b = 0, c = 0;
+    const double base = bench::time_ms([&] {
+        a = 0;
+        for (const auto& s : strs) a += push_back_lower(s)[0];
+        bench::do_not_optimize(a);
+    });
+    const double scalar = bench::time_ms([&] {
+        b = 0;
+        for (const auto& s : strs) b += scalar_lower(s)[0];
+        bench::do_not_optimize(b);
+    });
+    const double simd = bench::time_ms([&] {
+        c = 0;
+        for (const auto& s : strs) c += to_lower(s)[0];
+        bench::do_not_optimize(c);
+    });
+    if (a != b || a != c) std::printf("  MISMATCH\n");
+
+    const double mb = static_cast<double>(bytes) / 1e6;
+    std::printf("%s\n", name);
+    bench::report("push_back per char (baseline)", base, base);
+    bench::report("scalar map loop", scalar, base);
+    bench::report("to_lower (vector kernel)", simd, base);
+    std::printf("  %-34s %6.0f -> %.0f MB/s\n", "throughput", mb / (base / 1e3), mb / (simd / 1e3));
+}
+
+void bench_compare_ignore_case(const std::vector<fstring<64>>& names) {
+    std::vector<fstring<64>> lowered;
+    lowered.reserve(names.size());
+    for (const auto& s : names) lowered.push_back(s | to_lower);
+
+    std::size_t a = 0, b = 0;
+    const double base = bench::time_ms([&] {
+        a = 0;
+        for (std::size_t i = 0; i < names.size(); ++i) {
+            const auto& x = names[i];
+            const auto& y = lowered[i % 2 ? i : names.size() - 1 - i];
+            bool eq = x.size() == y.size();
+            for (std::size_t k = 0; eq && k < x.size(); ++k) eq = char_to_lower(x[k]) == char_to_lower(y[k]);
+            a += eq;
+        }
+        bench::do_not_optimize(a);
+    });
+    const double simd = bench::time_ms([&] {
+        b = 0;
+        for (std::size_t i = 0; i < names.size(); ++i) {
+            b += equals_ignore_case(names[i], lowered[i % 2 ? i : names.size() - 1 - i]);
+        }
+        bench::do_not_optimize(b);
+    });
+    if (a != b) std::printf("  MISMATCH %zu vs %zu\n", a, b);
+
+    std::printf("equals_ignore_case, header names\n");
+    bench::report("scalar loop (baseline)", base, base);
+    bench::report("vector kernel", simd, base);
+}
+
+} // namespace
+
+int main() {
+    const auto headers = make_headers<char, 64>(500'000);
+    lower_case("to_lower, header names (fstring<64>)", headers);
+    lower_case("to_lower, identifiers (fstring<128>)", make_identifiers<char, 128>(200'000));
+    lower_case("to_lower, identifiers (u16fstring<128>)", make_identifiers<char16_t, 128>(200'000));
+    bench_compare_ignore_case(headers);
+}
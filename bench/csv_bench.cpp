@@ -0,0 +1,121 @@
+/**
+ * @file bench/csv_bench.cpp
+ * @brief csv::reader vs a naive line + split(',') parser
+ *
+ * The baseline is what CSV parsing looked like before csv.hpp: each line
+ * copied into an fstring<256> and cut with split(','), which ignores
+ * quoting and keeps at most 16 fields. It only gets unquoted input with
+ * 12 columns, which it can parse correctly. csv::reader is timed on the
+ * same data (per-row callback and batches), then on a quoted variant with
+ * embedded delimiters, doubled quotes and CRLF endings. Data size defaults
+ * to 256 MiB; the first argument overrides it in MiB.
+ */
+
+#include <zuu/fstring.hpp>
+#include <zuu/io/csv.hpp>
+#include "bench.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+
+using namespace zuu;
+
+namespace {
+
+std::string make_csv(std::size_t bytes, bool quoted) {
+    std::mt19937_64 rng{17};
+    std::string out;
+    out.reserve(bytes + 512);
+    while (out.size() < bytes) {
+        for (int col = 0; col < 12; ++col) {
+            if (col) out += ',';
+            if (quoted && rng() % 4 == 0) {
+                out += "\"x, \"\"y\"\" ";
+                out += std::to_string(rng() % 10000);
+                out += '"';
+            } else {
+                const std::size_t len = 1 + rng() % 14;
+                for (std::size_t k = 0; k < len; ++k) out += static_cast<char>('a' + rng() % 26);
+            }
+        }
+        out += quoted ? "\r\n" : "\n";
+    }
+    return out;
+}
+
+struct counts {
+    std::uint64_t rows = 0;
+    std::uint64_t fields = 0;
+    std::uint64_t bytes = 0;
+};
+
+counts naive(const std::string& text) {
+    counts c;
+    auto lines = io::line_reader::from_memory(text);
+    fstring<256> line;
+    while (lines.next(line)) {
+        const auto parts = line | str::split(',');
+        ++c.rows;
+        c.fields += parts.count;
+        for (const auto& p : parts) c.bytes += p.size();
+    }
+    return c;
+}
+
+counts rows_api(const std::string& text) {
+    counts c;
+    auto in = csv::reader::from_memory(text);
+    in.for_each([&](const csv::row& r) {
+        ++c.rows;
+        c.fields += r.size();
+        for (auto f : r) c.bytes += f.size();
+    });
+    return c;
+}
+
+counts batch_api(const std::string& text) {
+    counts c;
+    auto in = csv::reader::from_memory(text);
+    csv::batch rows;
+    while (in.next_batch(rows, 4096)) {
+        for (auto r : rows.rows()) {
+            ++c.rows;
+            c.fields += r.size();
+            for (auto f : r) c.bytes += f.size();
+        }
+    }
+    return c;
+}
+
+void line(const char* name, double ms, double base, std::size_t bytes) {
+    bench::report(name, ms, base);
+    std::printf("  %-34s %9.2f GB/s\n", "", static_cast<double>(bytes) / 1e6 / ms);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t mib = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 256;
+    const std::string plain = make_csv(mib << 20, false);
+    const std::string quoted = make_csv(mib << 20, true);
+
+    counts a, b, c, d;
+    const double t_naive = bench::time_ms([&] { a = naive(plain); bench::do_not_optimize(a); }, 3);
+    const double t_rows = bench::time_ms([&] { b = rows_api(plain); bench::do_not_optimize(b); }, 3);
+    const double t_batch = bench::time_ms([&] { c = batch_api(plain); bench::do_not_optimize(c); }, 3);
+    const double t_quoted = bench::time_ms([&] { d = rows_api(quoted); bench::do_not_optimize(d); }, 3);
+
+    if (a.rows != b.rows || a.fields != b.fields || a.bytes != b.bytes || b.fields != c.fields) {
+        std::printf("result mismatch\n");
+    }
+
+    std::printf("unquoted: %zu MiB, %llu rows x 12 fields\n", mib, static_cast<unsigned long long>(b.rows));
+    line("line + split(',') (baseline)", t_naive, t_naive, plain.size());
+    line("csv::reader, per-row callback", t_rows, t_naive, plain.size());
+    line("csv::reader, batches of 4096", t_batch, t_naive, plain.size());
+    std::printf("quoted + CRLF: %llu rows\n", static_cast<unsigned long long>(d.rows));
+    line("csv::reader, per-row callback", t_quoted, t_naive, quoted.size());
+}
@@ -0,0 +1,118 @@
+/**
+ * @file bench/float_format_bench.cpp
+ * @brief Floating-point formatting: shortest and fixed output vs.
+ *        std::to_chars and snprintf
+ *
+ * Renders 1M doubles from two corpora into a comma-separated 4 KiB line
+ * buffer, as a metrics exporter would: latencies in milliseconds with a
+ * few decimals, and values spread over the whole double range. The
+ * baseline is the formatter before floating.hpp: cast to long long, then
+ * `frac *= 10` per digit for 6 fixed decimals (truncated, and wrong past
+ * 9.2e18). Fixed output with 6 decimals is compared against snprintf's
+ * "%.6f", and shortest output against std::to_chars and "%.17g", the
+ * usual way to get a round trip out of printf. fixed(v, 6) and "%.6f"
+ * produce the same line, as do the two shortest forms.
+ */
+
+#include <zuu/fstring.hpp>
+#include "bench.hpp"
+
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace zuu;
+using namespace zuu::fmt;
+
+namespace {
+
+using line_t = fstring<4096>;
+
+// The fixed-precision formatter floating.hpp replaced
+fstring<64> cast_and_scale(double value, int precision = 6) {
+    fstring<64> result;
+    if (value < 0) {
+        result.push_back('-');
+        value = -value;
+    }
+    const auto int_part = static_cast<long long>(value);
+    result += to_fstring(int_part);
+    result.push_back('.');
+    double frac = value - static_cast<double>(int_part);
+    for (int i = 0; i < precision; ++i) {
+        frac *= 10;
+        const int digit = static_cast<int>(frac);
+        result.push_back(static_cast<char>('0' + digit));
+        frac -= digit;
+    }
+    return result;
+}
+
+template <typename Put>
+double render(const std::vector<double>& values, std::size_t& acc, Put put) {
+    return bench::time_ms([&] {
+        line_t line;
+        acc = 0;
+        for (double v : values) {
+            if (line.available() < 400) {
+                acc += line.size() + static_cast<unsigned char>(line[line.size() / 2]);
+                line.clear();
+            }
+            put(line, v);
+            line.push_back(',');
+        }
+        acc += line.size();
+        bench::do_not_optimize(acc);
+    });
+}
+
+void printf_into(line_t& line, const char* format, double value) {
+    line.resize_and_overwrite(line.capacity, [&](char* p, std::size_t cap) {
+        const std::size_t n = line.size();
+        return n + static_cast<std::size_t>(std::snprintf(p + n, cap - n + 1, format, value));
+    });
+}
+
+void format_all(const char* name, const std::vector<double>& values) {
+    std::size_t a = 0, b = 0, c = 0, d = 0, e = 0, f = 0;
+    const double base = render(values, a, [](line_t& l, double v) { l += cast_and_scale(v); });
+    const double fixed6 = render(values, b, [](line_t& l, double v) { format_to(l, fixed(v, 6)); });
+    const double printf6 = render(values, c, [](line_t& l, double v) { printf_into(l, "%.6f", v); });
+    const double shortest = render(values, d, [](line_t& l, double v) { format_to(l, v); });
+    const double tc = render(values, e, [](line_t& l, double v) {
+        l.resize_and_overwrite(l.capacity, [&](char* p, std::size_t cap) {
+            return static_cast<std::size_t>(std::to_chars(p + l.size(), p + cap, v).ptr - p);
+        });
+    });
+    const double g17 = render(values, f, [](line_t& l, double v) { printf_into(l, "%.17g", v); });
+    if (b != c || d != e) std::printf("  MISMATCH\n");
+
+    std::printf("%s\n", name);
+    bench::report("cast + frac *= 10 (baseline)", base, base);
+    bench::report("format_to(line, fixed(v, 6))", fixed6, base);
+    bench::report("snprintf \"%.6f\"", printf6, base);
+    bench::report("format_to(line, v) shortest", shortest, base);
+    bench::report("std::to_chars shortest", tc, base);
+    bench::report("snprintf \"%.17g\" (round trip)", g17, base);
+}
+
+} // namespace
+
+int main() {
+    constexpr std::size_t count = 1'000'000;
+    std::mt19937_64 rng{42};
+
+    // Latencies: log-uniform over 0.01 ms - 10 s, 3 decimals
+    std::vector<double> latencies(count);
+    std::uniform_real_distribution<double> decade{-2.0, 4.0};
+    for (auto& v : latencies) v = std::round(std::pow(10.0, decade(rng)) * 1000.0) / 1000.0;
+    format_all("Latencies in ms (0.01 - 10000, 3 decimals)", latencies);
+
+    // Uniform exponent over the whole range; the baseline overflows here
+    std::vector<double> wide(count);
+    std::uniform_real_distribution<double> exponent{-300.0, 300.0};
+    for (auto& v : wide) v = (rng() % 2 ? -1.0 : 1.0) * std::pow(10.0, exponent(rng));
+    format_all("Whole double range (1e-300 - 1e300)", wide);
+}
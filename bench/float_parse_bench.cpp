@@ -0,0 +1,103 @@
+/**
+ * @file bench/float_parse_bench.cpp
+ * @brief Floating-point parsing: from_chars vs. std::from_chars and strtod
+ *
+ * Reads every field of a numeric CSV (1M rows of four columns) into
+ * doubles and sums them, as a loader would: prices with two decimals,
+ * ratios with six, small counts and measurements written shortest
+ * round-trip (%.17g, often with an exponent). The baseline is
+ * parse_float before parsing.hpp: digits accumulated in a double and the
+ * fraction scaled by `fraction *= 0.1` per digit, which is off in the
+ * last bits and stops at an exponent; it is shown for cost only. The
+ * three correct parsers produce the same sum.
+ */
+
+#include <zuu/fstring.hpp>
+#include "bench.hpp"
+
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+
+using namespace zuu;
+
+namespace {
+
+// The parse_float parsing.hpp replaced, returning the end of the number
+const char* scale_by_tenths(const char* p, const char* last, double& value) {
+    double result = 0;
+    bool negative = false;
+    if (p != last && (*p == '-' || *p == '+')) negative = *p++ == '-';
+    for (; p != last && *p >= '0' && *p <= '9'; ++p) result = result * 10 + (*p - '0');
+    if (p != last && *p == '.') {
+        double fraction = 0.1;
+        for (++p; p != last && *p >= '0' && *p <= '9'; ++p) {
+            result += (*p - '0') * fraction;
+            fraction *= 0.1;
+        }
+    }
+    value = negative ? -result : result;
+    return p;
+}
+
+// Each field's parse returns the end of its number; the delimiter follows
+template <typename Parse>
+double sum_fields(const std::string& csv, double& sum, Parse parse) {
+    return bench::time_ms([&] {
+        const char* p = csv.data();
+        const char* last = p + csv.size();
+        double total = 0;
+        while (p < last) {
+            double v = 0;
+            p = parse(p, last, v) + 1;
+            total += v;
+        }
+        sum = total;
+        bench::do_not_optimize(sum);
+    });
+}
+
+} // namespace
+
+int main() {
+    constexpr std::size_t rows = 1'000'000;
+    std::mt19937_64 rng{42};
+    std::uniform_real_distribution<double> unit{0.0, 1.0};
+
+    std::string csv;
+    char field[64];
+    for (std::size_t i = 0; i < rows; ++i) {
+        std::snprintf(field, sizeof field, "%.2f,", std::round(unit(rng) * 1e6) / 100);
+        csv += field;
+        std::snprintf(field, sizeof field, "%.6f,", unit(rng) * 2 - 1);
+        csv += field;
+        std::snprintf(field, sizeof field, "%u,", static_cast<unsigned>(rng() % 1000));
+        csv += field;
+        std::snprintf(field, sizeof field, "%.17g\n", std::pow(10.0, unit(rng) * 20 - 10));
+        csv += field;
+    }
+
+    double a = 0, b = 0, c = 0, d = 0;
+    const double base = sum_fields(csv, a, scale_by_tenths);
+    const double fast = sum_fields(csv, b, [](const char* p, const char* last, double& v) {
+        return fmt::from_chars(p, last, v).ptr;
+    });
+    const double std_fc = sum_fields(csv, c, [](const char* p, const char* last, double& v) {
+        return std::from_chars(p, last, v).ptr;
+    });
+    const double strtod_ = sum_fields(csv, d, [](const char* p, const char*, double& v) {
+        char* end;
+        v = std::strtod(p, &end);
+        return static_cast<const char*>(end);
+    });
+    if (b != c || b != d) std::printf("  MISMATCH\n");
+
+    std::printf("Numeric CSV, %zu rows x 4 columns (%zu bytes)\n", rows, csv.size());
+    bench::report("fraction *= 0.1 (baseline)", base, base);
+    bench::report("fmt::from_chars", fast, base);
+    bench::report("std::from_chars", std_fc, base);
+    bench::report("strtod", strtod_, base);
+}
@@ -0,0 +1,120 @@
+/**
+ * @file bench/fstring_map_bench.cpp
+ * @brief fstring_map<32, V> vs std::unordered_map<std::string, V>
+ *
+ * Insert, successful lookup, failed lookup and erase over 1M and 4M
+ * symbol-like keys. Lookups go through std::string_view for both maps
+ * (std::unordered_map uses a transparent hash so neither side allocates).
+ */
+
+#include <zuu/fstring.hpp>
+#include <zuu/container/fstring_map.hpp>
+#include "bench.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+using namespace zuu;
+
+namespace {
+
+struct string_hash {
+    using is_transparent = void;
+    std::size_t operator()(std::string_view sv) const noexcept {
+        return std::hash<std::string_view>{}(sv);
+    }
+};
+
+using std_map = std::unordered_map<std::string, std::uint32_t, string_hash, std::equal_to<>>;
+using flat_map = fstring_map<32, std::uint32_t>;
+
+std::vector<std::string> make_keys(std::size_t n, std::uint64_t seed) {
+    std::mt19937_64 rng{seed};
+    std::vector<std::string> keys(n);
+    for (auto& k : keys) {
+        const std::size_t len = 8 + rng() % 20;
+        k.resize(len);
+        for (auto& ch : k) ch = static_cast<char>("abcdefghijklmnopqrstuvwxyz_0123456789"[rng() % 37]);
+    }
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    std::shuffle(keys.begin(), keys.end(), rng);
+    return keys;
+}
+
+struct timings {
+    double insert, hit, miss, erase;
+};
+
+template <typename Map>
+timings run(const std::vector<std::string>& keys, const std::vector<std::string>& absent) {
+    timings t{};
+    Map map;
+
+    t.insert = bench::time_ms([&] {
+        map = Map{};
+        for (std::uint32_t i = 0; i < keys.size(); ++i) map.try_emplace(keys[i], i);
+    }, 3);
+
+    t.hit = bench::time_ms([&] {
+        std::uint64_t sum = 0;
+        for (const auto& k : keys) sum += map.find(std::string_view{k})->second;
+        bench::do_not_optimize(sum);
+    });
+
+    t.miss = bench::time_ms([&] {
+        std::size_t found = 0;
+        for (const auto& k : absent) found += map.find(std::string_view{k}) != map.end();
+        bench::do_not_optimize(found);
+    });
+
+    // Copy outside the timed region, then erase every key by view
+    Map copy = map;
+    t.erase = bench::time_ms([&] {
+        for (const auto& k : keys) {
+            if constexpr (std::is_same_v<Map, flat_map>) {
+                copy.erase(std::string_view{k});
+            } else {
+                copy.erase(copy.find(std::string_view{k}));
+            }
+        }
+        bench::do_not_optimize(copy);
+    }, 1);
+
+    return t;
+}
+
+void compare(std::size_t n) {
+    const auto keys = make_keys(n, 7);
+    const auto absent = make_keys(n, 99);
+
+    const auto base = run<std_map>(keys, absent);
+    const auto flat = run<flat_map>(keys, absent);
+
+    std::printf("%zu keys\n", keys.size());
+    std::printf("std::unordered_map<std::string, u32> (baseline)\n");
+    bench::report("insert", base.insert, base.insert);
+    bench::report("lookup (hit)", base.hit, base.hit);
+    bench::report("lookup (miss)", base.miss, base.miss);
+    bench::report("erase all", base.erase, base.erase);
+    std::printf("fstring_map<32, u32>\n");
+    bench::report("insert", flat.insert, base.insert);
+    bench::report("lookup (hit)", flat.hit, base.hit);
+    bench::report("lookup (miss)", flat.miss, base.miss);
+    bench::report("erase all", flat.erase, base.erase);
+    std::printf("\n");
+}
+
+} // namespace
+
+int main() {
+    compare(1'000'000);
+    compare(4'000'000);
+}
@@ -0,0 +1,129 @@
+/**
+ * @file bench/int_format_bench.cpp
+ * @brief Integer formatting: digit-pair writer vs. std::to_chars and snprintf
+ *
+ * Renders 2M values from three corpora into a comma-separated 4 KiB line
+ * buffer, as a metrics exporter would: small counters (0-9999), 32-bit
+ * IDs spread over every length, and signed 64-bit values. The baseline
+ * is the formatter before digits.hpp: divide by 10 per digit into a
+ * reversed temporary, then push_back each digit. to_fstring appends its
+ * result, format_to writes in place, and std::to_chars and snprintf
+ * write in place through resize_and_overwrite; all produce the same line.
+ * For short values the by-value fstring that to_fstring returns, and its
+ * copy into the line, cost more than the digits: format_to is the form
+ * for loops like this one.
+ */
+
+#include <zuu/fstring.hpp>
+#include "bench.hpp"
+
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+using namespace zuu;
+using namespace zuu::fmt;
+
+namespace {
+
+using line_t = fstring<4096>;
+
+// The per-digit formatter digits.hpp replaced
+template <typename T>
+basic_fstring<char, std::numeric_limits<T>::digits10 + 3> per_digit(T value) {
+    basic_fstring<char, std::numeric_limits<T>::digits10 + 3> result;
+    if (value == 0) {
+        result.push_back('0');
+        return result;
+    }
+    using U = std::make_unsigned_t<T>;
+    U u = static_cast<U>(value);
+    if (value < 0) {
+        result.push_back('-');
+        u = static_cast<U>(0u - u);
+    }
+    char buffer[24];
+    std::size_t pos = 0;
+    while (u > 0) {
+        buffer[pos++] = static_cast<char>('0' + u % 10);
+        u /= 10;
+    }
+    while (pos > 0) result.push_back(buffer[--pos]);
+    return result;
+}
+
+template <typename T>
+void via_to_chars(line_t& line, T value) {
+    line.resize_and_overwrite(line.capacity, [&](char* p, std::size_t cap) {
+        return static_cast<std::size_t>(std::to_chars(p + line.size(), p + cap, value).ptr - p);
+    });
+}
+
+template <typename T>
+void via_snprintf(line_t& line, T value) {
+    line.resize_and_overwrite(line.capacity, [&](char* p, std::size_t cap) {
+        const std::size_t n = line.size();
+        const int w = std::is_signed_v<T>
+            ? std::snprintf(p + n, cap - n + 1, "%lld", static_cast<long long>(value))
+            : std::snprintf(p + n, cap - n + 1, "%llu", static_cast<unsigned long long>(value));
+        return n + static_cast<std::size_t>(w);
+    });
+}
+
+template <typename T>
+void format_all(const char* name, const std::vector<T>& values) {
+    std::size_t a = 0, b = 0, c = 0, d = 0, e = 0;
+    const auto render = [&](std::size_t& acc, auto put) {
+        return bench::time_ms([&] {
+            line_t line;
+            acc = 0;
+            for (T v : values) {
+                if (line.available() < 24) {
+                    acc += line.size() + static_cast<unsigned char>(line[line.size() / 2]);
+                    line.clear();
+                }
+                put(line, v);
+                line.push_back(',');
+            }
+            acc += line.size();
+            bench::do_not_optimize(acc);
+        });
+    };
+    const double base = render(a, [](line_t& l, T v) { l += per_digit(v); });
+    const double copy = render(b, [](line_t& l, T v) { l += to_fstring(v); });
+    const double fast = render(c, [](line_t& l, T v) { format_to(l, v); });
+    const double tc = render(d, [](line_t& l, T v) { via_to_chars(l, v); });
+    const double sn = render(e, [](line_t& l, T v) { via_snprintf(l, v); });
+    if (a != b || a != c || a != d || a != e) std::printf("  MISMATCH\n");
+
+    std::printf("%s\n", name);
+    bench::report("per digit + push_back (baseline)", base, base);
+    bench::report("line += to_fstring(v)", copy, base);
+    bench::report("format_to(line, v)", fast, base);
+    bench::report("std::to_chars in place", tc, base);
+    bench::report("snprintf in place", sn, base);
+}
+
+} // namespace
+
+int main() {
+    constexpr std::size_t count = 2'000'000;
+    std::mt19937_64 rng{42};
+
+    std::vector<std::uint32_t> counters(count);
+    for (auto& v : counters) v = static_cast<std::uint32_t>(rng() % 10000);
+    format_all("Counters 0-9999 (uint32_t)", counters);
+
+    // Uniform bit length, so every digit count shows up
+    std::vector<std::uint32_t> ids(count);
+    for (auto& v : ids) v = static_cast<std::uint32_t>(rng()) >> (rng() % 32);
+    format_all("IDs, all lengths (uint32_t)", ids);
+
+    std::vector<std::int64_t> wide(count);
+    for (auto& v : wide) v = static_cast<std::int64_t>(rng()) >> (rng() % 64);
+    format_all("Signed values, all lengths (int64_t)", wide);
+}
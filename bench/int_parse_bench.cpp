@@ -0,0 +1,115 @@
+/**
+ * @file bench/int_parse_bench.cpp
+ * @brief Integer parsing: from_chars vs. std::from_chars and strtoll
+ *
+ * Reads 2M comma-separated values from three corpora and sums them, as a
+ * loader would: small counters (0-9999), 32-bit IDs spread over every
+ * length, and signed 64-bit values. The baseline is parse_int before
+ * parsing.hpp: one digit per iteration, a range compare for each of
+ * three digit classes and no overflow check. fmt::from_chars reads 8
+ * digits per step (16 when built for AVX2, with the length found in the
+ * same step) and checks overflow once per number; all produce the same
+ * sum.
+ */
+
+#include <zuu/fstring.hpp>
+#include "bench.hpp"
+
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace zuu;
+
+namespace {
+
+// The parse_int parsing.hpp replaced, returning the end of the number
+template <typename T>
+const char* per_digit(const char* p, const char* last, T& value) {
+    T result = 0;
+    bool negative = false;
+    if (p != last && (*p == '-' || *p == '+')) negative = *p++ == '-';
+    for (; p != last; ++p) {
+        int digit = -1;
+        if (*p >= '0' && *p <= '9') {
+            digit = *p - '0';
+        } else if (*p >= 'a' && *p <= 'z') {
+            digit = 10 + (*p - 'a');
+        } else if (*p >= 'A' && *p <= 'Z') {
+            digit = 10 + (*p - 'A');
+        }
+        if (digit < 0 || digit >= 10) break;
+        result = result * 10 + digit;
+    }
+    value = negative ? -result : result;
+    return p;
+}
+
+template <typename T, typename Parse>
+double sum_fields(const std::string& csv, T& sum, Parse parse) {
+    return bench::time_ms([&] {
+        const char* p = csv.data();
+        const char* last = p + csv.size();
+        T total = 0;
+        while (p < last) {
+            T v = 0;
+            p = parse(p, last, v) + 1;
+            total += v;
+        }
+        sum = total;
+        bench::do_not_optimize(sum);
+    });
+}
+
+template <typename T>
+void parse_all(const char* name, const std::vector<T>& values) {
+    std::string csv;
+    for (T v : values) csv += std::to_string(v) + ',';
+
+    // Sums wrap alike for all four; unsigned arithmetic keeps that defined
+    using U = std::make_unsigned_t<T>;
+    T a = 0, b = 0, c = 0, d = 0;
+    const double base = sum_fields(csv, a, per_digit<T>);
+    const double fast = sum_fields(csv, b, [](const char* p, const char* last, T& v) {
+        return fmt::from_chars(p, last, v).ptr;
+    });
+    const double std_fc = sum_fields(csv, c, [](const char* p, const char* last, T& v) {
+        return std::from_chars(p, last, v).ptr;
+    });
+    const double strto = sum_fields(csv, d, [](const char* p, const char*, T& v) {
+        char* end;
+        v = static_cast<T>(std::is_signed_v<T> ? std::strtoll(p, &end, 10) : std::strtoull(p, &end, 10));
+        return static_cast<const char*>(end);
+    });
+    if (U(a) != U(b) || U(b) != U(c) || U(b) != U(d)) std::printf("  MISMATCH\n");
+
+    std::printf("%s\n", name);
+    bench::report("per digit (baseline)", base, base);
+    bench::report("fmt::from_chars", fast, base);
+    bench::report("std::from_chars", std_fc, base);
+    bench::report(std::is_signed_v<T> ? "strtoll" : "strtoull", strto, base);
+}
+
+} // namespace
+
+int main() {
+    constexpr std::size_t count = 2'000'000;
+    std::mt19937_64 rng{42};
+
+    std::vector<std::uint32_t> counters(count);
+    for (auto& v : counters) v = static_cast<std::uint32_t>(rng() % 10000);
+    parse_all("Counters 0-9999 (uint32_t)", counters);
+
+    // Uniform bit length, so every digit count shows up
+    std::vector<std::uint32_t> ids(count);
+    for (auto& v : ids) v = static_cast<std::uint32_t>(rng()) >> (rng() % 32);
+    parse_all("IDs, all lengths (uint32_t)", ids);
+
+    std::vector<std::int64_t> wide(count);
+    for (auto& v : wide) v = static_cast<std::int64_t>(rng()) >> (rng() % 64);
+    parse_all("Signed values, all lengths (int64_t)", wide);
+}
@@ -0,0 +1,118 @@
+/**
+ * @file bench/layout_bench.cpp
+ * @brief Compact basic_fstring layout vs. the old char[Cap + 1] + size_t layout
+ *
+ * Builds a large array of short keys in both layouts and measures a
+ * sequential scan, random probes (cache-miss bound once the array
+ * outgrows the LLC) and a sort.
+ */
+
+#include <zuu/fstring.hpp>
+#include "bench.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace zuu;
+
+namespace {
+
+// Previous layout: terminator slot plus a separate size_t length
+template <std::size_t Cap>
+struct legacy_fstring {
+    char data[Cap + 1]{};
+    std::size_t size{};
+
+    legacy_fstring() = default;
+    explicit legacy_fstring(std::string_view sv) : size{std::min(Cap, sv.size())} {
+        std::memcpy(data, sv.data(), size);
+    }
+
+    [[nodiscard]] std::string_view view() const noexcept { return {data, size}; }
+    friend bool operator<(const legacy_fstring& a, const legacy_fstring& b) noexcept {
+        return a.view() < b.view();
+    }
+};
+
+template <std::size_t Cap>
+std::string_view view_of(const fstring<Cap>& s) noexcept { return s; }
+
+template <std::size_t Cap>
+std::string_view view_of(const legacy_fstring<Cap>& s) noexcept { return s.view(); }
+
+struct results {
+    double scan, probe, sort;
+};
+
+template <typename Key>
+results run(const std::vector<std::string_view>& words, const std::vector<std::uint32_t>& probes) {
+    std::vector<Key> keys;
+    keys.reserve(words.size());
+    for (auto w : words) keys.emplace_back(w);
+
+    results r{};
+    r.scan = bench::time_ms([&] {
+        std::size_t total = 0;
+        for (const auto& k : keys) total += view_of(k).size();
+        bench::do_not_optimize(total);
+    });
+    r.probe = bench::time_ms([&] {
+        std::size_t total = 0;
+        for (auto i : probes) total += static_cast<unsigned char>(view_of(keys[i]).back());
+        bench::do_not_optimize(total);
+    });
+    r.sort = bench::time_ms([&] {
+        auto copy = keys;
+        std::sort(copy.begin(), copy.end());
+        bench::do_not_optimize(copy.front());
+    }, 2);
+    return r;
+}
+
+} // namespace
+
+int main() {
+    constexpr std::size_t key_count = 8'000'000;
+    constexpr std::size_t probe_count = 4'000'000;
+    constexpr std::size_t cap = 15;
+
+    std::mt19937_64 rng{42};
+    std::vector<std::string> storage(key_count);
+    std::vector<std::string_view> words(key_count);
+    for (std::size_t i = 0; i < key_count; ++i) {
+        const std::size_t len = 4 + rng() % 12;
+        storage[i].resize(len);
+        for (auto& ch : storage[i]) ch = static_cast<char>('a' + rng() % 26);
+        words[i] = storage[i];
+    }
+
+    std::vector<std::uint32_t> probes(probe_count);
+    for (auto& p : probes) p = static_cast<std::uint32_t>(rng() % key_count);
+
+    const auto legacy = run<legacy_fstring<cap>>(words, probes);
+    const auto compact = run<fstring<cap>>(words, probes);
+
+    std::printf("fstring<%zu> layout, %zu keys\n", cap, key_count);
+    std::printf("  bytes per key: legacy %zu, compact %zu\n",
+                sizeof(legacy_fstring<cap>), sizeof(fstring<cap>));
+    std::printf("  array footprint: legacy %.1f MiB, compact %.1f MiB\n",
+                key_count * sizeof(legacy_fstring<cap>) / 1048576.0,
+                key_count * sizeof(fstring<cap>) / 1048576.0);
+    std::printf("  keys per 64-byte cache line: legacy %zu, compact %zu\n\n",
+                64 / sizeof(legacy_fstring<cap>), 64 / sizeof(fstring<cap>));
+
+    std::printf("legacy layout (baseline)\n");
+    bench::report("sequential length scan", legacy.scan, legacy.scan);
+    bench::report("random probes", legacy.probe, legacy.probe);
+    bench::report("sort", legacy.sort, legacy.sort);
+
+    std::printf("compact layout\n");
+    bench::report("sequential length scan", compact.scan, legacy.scan);
+    bench::report("random probes", compact.probe, legacy.probe);
+    bench::report("sort", compact.sort, legacy.sort);
+}
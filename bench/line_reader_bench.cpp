@@ -0,0 +1,97 @@
+/**
+ * @file bench/line_reader_bench.cpp
+ * @brief io::line_reader (buffered and mapped) vs std::getline
+ *
+ * Generates a log-like file (default 2 GiB; first argument overrides the
+ * size in MiB, second the path) and reads it line by line, touching each
+ * line's length so no reader can skip work. The file is written first,
+ * so reads come from the page cache and measure parsing, not the disk.
+ */
+
+#include <zuu/fstring.hpp>
+#include <zuu/io/line_reader.hpp>
+#include "bench.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+
+using namespace zuu;
+
+namespace {
+
+void generate(const std::string& path, std::size_t bytes) {
+    std::mt19937_64 rng{1};
+    std::ofstream out{path, std::ios::binary};
+    std::string chunk;
+    std::size_t written = 0;
+    while (written < bytes) {
+        chunk.clear();
+        while (chunk.size() < (1u << 20)) {
+            chunk += "2025-11-26T12:00:00Z INFO request id=";
+            chunk += std::to_string(rng() % 1'000'000);
+            chunk.append(rng() % 120, 'x');
+            chunk += rng() % 4 == 0 ? "\r\n" : "\n";
+        }
+        out.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+        written += chunk.size();
+    }
+}
+
+struct tally {
+    std::uint64_t lines = 0;
+    std::uint64_t bytes = 0;
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t mib = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2048;
+    const std::string path = argc > 2 ? argv[2]
+        : (std::filesystem::temp_directory_path() / "zuu_line_reader_bench.log").string();
+
+    generate(path, mib << 20);
+    const double gb = static_cast<double>(std::filesystem::file_size(path)) / 1e9;
+
+    tally t_getline, t_buffered, t_mapped;
+
+    const double base = bench::time_ms([&] {
+        t_getline = {};
+        std::ifstream in{path, std::ios::binary};
+        std::string line;
+        while (std::getline(in, line)) {
+            ++t_getline.lines;
+            t_getline.bytes += line.size();
+        }
+    }, 2);
+
+    const auto run = [&](io::read_mode mode, tally& t) {
+        return bench::time_ms([&] {
+            t = {};
+            io::line_reader in{path.c_str(), {.mode = mode}};
+            for (std::string_view line : in) {
+                ++t.lines;
+                t.bytes += line.size();
+            }
+        }, 2);
+    };
+    const double buffered = run(io::read_mode::buffered, t_buffered);
+    const double mapped = run(io::read_mode::mapped, t_mapped);
+
+    if (t_buffered.lines != t_getline.lines || t_mapped.lines != t_getline.lines) {
+        std::printf("line count mismatch\n");
+    }
+
+    std::printf("%.2f GB, %llu lines\n", gb, static_cast<unsigned long long>(t_getline.lines));
+    bench::report("std::getline (baseline)", base, base);
+    bench::report("line_reader, buffered", buffered, base);
+    bench::report("line_reader, mapped", mapped, base);
+    std::printf("  %-34s %.2f / %.2f / %.2f GB/s\n", "throughput",
+                gb / (base / 1e3), gb / (buffered / 1e3), gb / (mapped / 1e3));
+
+    std::filesystem::remove(path);
+}
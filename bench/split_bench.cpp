@@ -0,0 +1,108 @@
+/**
+ * @file bench/split_bench.cpp
+ * @brief Delimiter-bitmask tokenizing vs. a per-character scan
+ *
+ * A 16 MiB log-like buffer (CRLF lines of space-separated, comma-joined
+ * fields) is tokenized by lines, whitespace and ','. The baseline
+ * classifies one character at a time, as split/split_lines/
+ * split_whitespace did before; the vector path is the
+ * detail::simd::for_each_token kernel those functions now use at runtime.
+ * Also times the eager split_lines/split_whitespace on 256-byte records.
+ */
+
+#include <zuu/fstring.hpp>
+#include "bench.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace zuu;
+
+namespace {
+
+std::string make_buffer(std::size_t bytes) {
+    std::mt19937_64 rng{42};
+    std::string buf;
+    buf.reserve(bytes + 256);
+    while (buf.size() < bytes) {
+        const std::size_t fields = 4 + rng() % 12;
+        for (std::size_t f = 0; f < fields; ++f) {
+            const std::size_t len = 2 + rng() % 14;
+            for (std::size_t k = 0; k < len; ++k) buf.push_back(static_cast<char>('a' + rng() % 26));
+            buf.push_back(rng() % 3 == 0 ? ',' : ' ');
+        }
+        buf += "\r\n";
+    }
+    return buf;
+}
+
+template <typename Pred>
+std::size_t scalar_tokens(const std::string& buf, Pred is_delim) {
+    std::size_t tokens = 0, start = 0;
+    for (std::size_t i = 0; i < buf.size(); ++i) {
+        if (is_delim(buf[i])) {
+            tokens += i > start;
+            start = i + 1;
+        }
+    }
+    return tokens + (buf.size() > start);
+}
+
+template <typename Matcher>
+std::size_t vector_tokens(const std::string& buf, const Matcher& m) {
+    std::size_t tokens = 0;
+    detail::simd::for_each_token(buf.data(), buf.size(), m, [&](std::size_t, std::size_t) {
+        ++tokens;
+        return true;
+    });
+    return tokens;
+}
+
+template <typename Pred, typename Matcher>
+void compare(const char* name, const std::string& buf, Pred pred, const Matcher& m) {
+    std::size_t a = 0, b = 0;
+    const double base = bench::time_ms([&] { a = scalar_tokens(buf, pred); bench::do_not_optimize(a); });
+    const double fast = bench::time_ms([&] { b = vector_tokens(buf, m); bench::do_not_optimize(b); });
+    if (a != b) std::printf("  MISMATCH %zu vs %zu\n", a, b);
+
+    const double gb = static_cast<double>(buf.size()) / 1e9;
+    std::printf("%s (%zu tokens)\n", name, b);
+    bench::report("per-character (baseline)", base, base);
+    bench::report("delimiter bitmask", fast, base);
+    std::printf("  %-34s %6.2f -> %.2f GB/s\n", "throughput", gb / (base / 1e3), gb / (fast / 1e3));
+}
+
+} // namespace
+
+int main() {
+    const std::string buf = make_buffer(16u << 20);
+
+    compare("lines (CRLF)", buf,
+            [](char c) { return c == '\n' || c == '\r'; }, detail::simd::line_matcher<char>{});
+    compare("whitespace", buf,
+            [](char c) { return c == ' ' || (c >= '\t' && c <= '\r'); }, detail::simd::space_matcher<char>{});
+    compare("char ','", buf,
+            [](char c) { return c == ','; }, detail::simd::unit_matcher<char>{','});
+
+    // Eager splits on short records
+    std::vector<fstring<256>> records;
+    for (std::size_t pos = 0; records.size() < 50'000; pos += 200) {
+        records.emplace_back(buf.data() + pos, 200);
+    }
+    const double lines = bench::time_ms([&] {
+        std::size_t n = 0;
+        for (const auto& r : records) n += (r | str::split_lines).count;
+        bench::do_not_optimize(n);
+    });
+    const double words = bench::time_ms([&] {
+        std::size_t n = 0;
+        for (const auto& r : records) n += (r | str::split_whitespace).count;
+        bench::do_not_optimize(n);
+    });
+    std::printf("eager split on %zu x 200-byte records\n", records.size());
+    std::printf("  %-34s %9.2f ms\n", "split_lines", lines);
+    std::printf("  %-34s %9.2f ms\n", "split_whitespace", words);
+}
@@ -0,0 +1,179 @@
+/**
+ * @file bench/unicode_case_bench.cpp
+ * @brief Unicode case mapping: ASCII fast path vs. per-code-point lookup
+ *
+ * Lowercases and case-folds 300k user names (u8fstring<64>, and the
+ * same names as u16fstring<64>) from three corpora: plain ASCII, Latin
+ * names with occasional accents, and Greek/Cyrillic names that are
+ * almost all non-ASCII; then 100k lines of French prose (u8fstring<256>).
+ * The baseline decodes every code point, looks it up in the tables and
+ * re-encodes it, as the constant-evaluation path does; unicode::to_lower
+ * hands all-ASCII strings, and ASCII vectors of longer mixed text, to
+ * the vector kernels.
+ * str::to_lower (ASCII only) is shown for the ASCII corpus as the
+ * ceiling, and caseless comparison is measured on the mixed corpus.
+ */
+
+#include <zuu/fstring.hpp>
+#include "bench.hpp"
+
+#include <cstdio>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace zuu;
+using namespace zuu::str;
+
+namespace {
+
+constexpr std::u32string_view ascii_names[] = {
+    U"Alice", U"Robert", U"MARGARET", U"Jean-Paul", U"o'Brien", U"Zhang Wei",
+    U"Priya", U"McAllister", U"Oluwaseun", U"Hiroshi", U"Van Der Berg",
+};
+
+constexpr std::u32string_view latin_names[] = {
+    U"Émile", U"Zoë", U"Müller", U"François", U"Ståle", U"Łukasz",
+    U"Søren", U"José", U"Nuñez", U"Çelik", U"Dvořák", U"Ölander",
+};
+
+constexpr std::u32string_view french_words[] = {
+    U"le", U"la", U"des", U"avec", U"pour", U"nous", U"dans", U"Paris", U"rue",
+    U"maison", U"jardin", U"soleil", U"matin", U"toujours", U"été", U"très",
+    U"déjà", U"château", U"fenêtre", U"Noël", U"garçon", U"où", U"ÉCOLE",
+};
+
+constexpr std::u32string_view script_names[] = {
+    U"Αλέξανδρος", U"ΔΗΜΗΤΡΗΣ", U"Ελένη", U"Дмитрий", U"НАТАЛЬЯ",
+    U"Ирина", U"Ὀδυσσεύς", U"Σωκράτης", U"Ярослав", U"Ёлка",
+};
+
+template <meta::character CharT, std::size_t Cap>
+void append_utf(basic_fstring<CharT, Cap>& s, char32_t cp) {
+    CharT buf[4];
+    const unsigned len = detail::unicode_case::encoded_length<CharT>(cp);
+    if (s.size() + len > Cap) return;
+    detail::unicode_case::encode(cp, buf);
+    s.append(buf, len);
+}
+
+// `words` to `words + 1` pool entries per string, randomly cased
+template <meta::character CharT, std::size_t Cap, std::size_t N>
+std::vector<basic_fstring<CharT, Cap>> make_names(const std::u32string_view (&pool)[N], std::size_t count,
+                                                  std::size_t words = 2) {
+    std::mt19937_64 rng{42};
+    std::vector<basic_fstring<CharT, Cap>> out;
+    out.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        basic_fstring<CharT, Cap> s;
+        for (std::size_t w = words + rng() % 2; w > 0; --w) {
+            for (char32_t c : pool[rng() % N]) {
+                const unsigned r = rng() % 4;
+                append_utf(s, r == 0 ? unicode::simple_upper(c) : r == 1 ? unicode::simple_lower(c) : c);
+            }
+            if (w > 1) append_utf(s, U' ');
+        }
+        out.push_back(s);
+    }
+    return out;
+}
+
+// Every code point decoded, looked up and re-encoded
+template <meta::character CharT, std::size_t Cap>
+basic_fstring<CharT, Cap> per_code_point_lower(const basic_fstring<CharT, Cap>& s) {
+    basic_fstring<CharT, Cap> r;
+    r.resize_and_overwrite(Cap, [&](CharT* p, std::size_t room) {
+        std::size_t i = 0, w = 0;
+        while (i < s.size()) {
+            const auto d = detail::unicode_case::decode(s.data() + i, s.size() - i);
+            const char32_t cp = unicode::simple_lower(d.cp);
+            const unsigned len = detail::unicode_case::encoded_length<CharT>(cp);
+            if (len > room - w) break;
+            detail::unicode_case::encode(cp, p + w);
+            w += len;
+            i += d.len;
+        }
+        return w;
+    });
+    return r;
+}
+
+template <typename Str>
+void lower_case(const char* name, const std::vector<Str>& strs, bool ascii_ceiling) {
+    std::size_t bytes = 0;
+    for (const auto& s : strs) bytes += s.size() * sizeof(s[0]);
+
+    std::size_t a = 0, b = 0, c = 0, d = 0;
+    const double base = bench::time_ms([&] {
+        a = 0;
+        for (const auto& s : strs) a += per_code_point_lower(s).back();
+        bench::do_not_optimize(a);
+    });
+    const double fast = bench::time_ms([&] {
+        b = 0;
+        for (const auto& s : strs) b += (s | unicode::to_lower).back();
+        bench::do_not_optimize(b);
+    });
+    const double fold = bench::time_ms([&] {
+        c = 0;
+        for (const auto& s : strs) c += (s | unicode::fold_case).size();
+        bench::do_not_optimize(c);
+    });
+    if (a != b) std::printf("  MISMATCH\n");
+
+    const double mb = static_cast<double>(bytes) / 1e6;
+    std::printf("%s\n", name);
+    bench::report("per code point (baseline)", base, base);
+    bench::report("unicode::to_lower", fast, base);
+    bench::report("unicode::fold_case", fold, base);
+    if (ascii_ceiling) {
+        const double ascii = bench::time_ms([&] {
+            d = 0;
+            for (const auto& s : strs) d += to_lower(s).back();
+            bench::do_not_optimize(d);
+        });
+        if (a != d) std::printf("  MISMATCH\n");
+        bench::report("str::to_lower (ASCII only)", ascii, base);
+    }
+    std::printf("  %-34s %6.0f -> %.0f MB/s\n", "throughput", mb / (base / 1e3), mb / (fast / 1e3));
+}
+
+template <typename Str>
+void compare_folded(const char* name, const std::vector<Str>& names) {
+    std::vector<Str> upper;
+    upper.reserve(names.size());
+    for (const auto& s : names) upper.push_back(s | unicode::to_upper);
+
+    std::size_t a = 0, b = 0;
+    const double base = bench::time_ms([&] {
+        a = 0;
+        for (std::size_t i = 0; i < names.size(); ++i) {
+            a += (names[i] | unicode::fold_case) == (upper[i] | unicode::fold_case);
+        }
+        bench::do_not_optimize(a);
+    });
+    const double fast = bench::time_ms([&] {
+        b = 0;
+        for (std::size_t i = 0; i < names.size(); ++i) b += unicode::equals_ignore_case(names[i], upper[i]);
+        bench::do_not_optimize(b);
+    });
+    if (a != b) std::printf("  MISMATCH %zu vs %zu\n", a, b);
+
+    std::printf("%s\n", name);
+    bench::report("fold both, then == (baseline)", base, base);
+    bench::report("unicode::equals_ignore_case", fast, base);
+}
+
+} // namespace
+
+int main() {
+    constexpr std::size_t count = 300'000;
+    lower_case("ASCII names (u8fstring<64>)", make_names<char8_t, 64>(ascii_names, count), true);
+    const auto latin = make_names<char8_t, 64>(latin_names, count);
+    lower_case("Latin names, some accents (u8fstring<64>)", latin, false);
+    lower_case("Greek/Cyrillic names (u8fstring<64>)", make_names<char8_t, 64>(script_names, count), false);
+    lower_case("Latin names, some accents (u16fstring<64>)", make_names<char16_t, 64>(latin_names, count), false);
+    lower_case("French prose (u8fstring<256>)", make_names<char8_t, 256>(french_words, count / 3, 30), false);
+    compare_folded("equals_ignore_case, Latin names (u8fstring<64>)", latin);
+}
@@ -0,0 +1,560 @@
+#pragma once
+
+/**
+ * @file zuu/container/fstring_map.hpp
+ * @brief Open-addressing hash map with inline fixed-capacity string keys
+ * @version 3.0.0
+ *
+ * Design Philosophy:
+ * - Swiss-table layout: one control byte per slot holding a 7-bit hash
+ *   fragment, probed 16 slots at a time with SSE2 compares
+ * - Keys live inline in the slot array (no per-node allocation)
+ * - Stored keys are canonical (zero past size), so short keys compare with
+ *   a single fixed-size memcmp over the whole buffer
+ * - Heterogeneous lookup: string_view, C strings and fstrings of any
+ *   capacity probe without building a std::string
+ *
+ * Usage:
+ *   fstring_map<32, int> ids;
+ *   ids["alpha"] = 1;
+ *   ids.try_emplace(name_view, 2);
+ *   if (auto it = ids.find(std::string_view{"alpha"}); it != ids.end()) { ... }
+ *   ids.erase("alpha");
+ */
+
+#include "../core/core.hpp"
+#include "../core/hash.hpp"
+#include "../core/simd.hpp"
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+namespace zuu::detail::swiss {
+
+// ==================== Control Bytes ====================
+
+using ctrl_t = std::int8_t;
+
+// Full slots hold the 7-bit fragment (0..127); the sign bit marks free slots
+inline constexpr ctrl_t ctrl_empty = -128;
+inline constexpr ctrl_t ctrl_deleted = -2;
+
+inline constexpr std::size_t group_width = 16;
+
+/**
+ * @brief 16 control bytes matched at once; bit i of a mask is slot i
+ */
+class group {
+#if defined(ZUU_SIMD_SSE2)
+    __m128i ctrl_;
+
+public:
+    explicit group(const ctrl_t* p) noexcept
+        : ctrl_{_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))} {}
+
+    [[nodiscard]] std::uint32_t match(ctrl_t h2) const noexcept {
+        return static_cast<std::uint32_t>(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl_, _mm_set1_epi8(h2))));
+    }
+
+    [[nodiscard]] std::uint32_t match_empty() const noexcept {
+        return match(ctrl_empty);
+    }
+
+    [[nodiscard]] std::uint32_t match_free() const noexcept {
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(ctrl_));
+    }
+#else
+    const ctrl_t* ctrl_;
+
+    template <typename Pred>
+    std::uint32_t mask_of(Pred pred) const noexcept {
+        std::uint32_t mask = 0;
+        for (std::size_t i = 0; i < group_width; ++i) {
+            if (pred(ctrl_[i])) mask |= 1u << i;
+        }
+        return mask;
+    }
+
+public:
+    explicit group(const ctrl_t* p) noexcept : ctrl_{p} {}
+
+    [[nodiscard]] std::uint32_t match(ctrl_t h2) const noexcept {
+        return mask_of([h2](ctrl_t c) { return c == h2; });
+    }
+
+    [[nodiscard]] std::uint32_t match_empty() const noexcept {
+        return match(ctrl_empty);
+    }
+
+    [[nodiscard]] std::uint32_t match_free() const noexcept {
+        return mask_of([](ctrl_t c) { return c < 0; });
+    }
+#endif
+};
+
+} // namespace zuu::detail::swiss
+
+namespace zuu {
+
+// ==================== Flat String Map ====================
+
+/**
+ * @brief Swiss-table map from basic_fstring<CharT, Cap> keys to V
+ *
+ * Slots are grouped 16 to a control group; probing walks groups in
+ * triangular order and stops at the first group with an empty slot. The
+ * table keeps at most 7/8 of its slots occupied (including tombstones).
+ *
+ * Keys longer than Cap are rejected on insertion (std::length_error) and
+ * are simply not found by lookups.
+ */
+template <meta::character CharT, std::size_t Cap, typename V>
+class basic_fstring_map {
+public:
+    using key_type = basic_fstring<CharT, Cap>;
+    using mapped_type = V;
+    using value_type = std::pair<const key_type, V>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using view_type = std::basic_string_view<CharT>;
+
+private:
+    using ctrl_t = detail::swiss::ctrl_t;
+    using group = detail::swiss::group;
+    using alloc_traits = std::allocator_traits<std::allocator<value_type>>;
+
+    static constexpr size_type width = detail::swiss::group_width;
+    static constexpr size_type npos_slot = static_cast<size_type>(-1);
+
+    // Whole-buffer compare (length included) while the key is small
+    static constexpr bool fixed_compare =
+        key_type::size_in_tail && (Cap + 1) * sizeof(CharT) <= 64;
+
+    ctrl_t* ctrl_ = nullptr;
+    value_type* slots_ = nullptr;
+    size_type slot_count_ = 0;       // groups * 16, 0 when unallocated
+    size_type size_ = 0;
+    size_type growth_left_ = 0;
+
+    // ==================== Helpers ====================
+
+    static std::uint64_t hash_of(view_type key) noexcept {
+        return hash_string(key);
+    }
+
+    static ctrl_t h2(std::uint64_t hash) noexcept {
+        return static_cast<ctrl_t>(hash & 0x7F);
+    }
+
+    static bool key_equal(const key_type& a, const key_type& b) noexcept {
+        if constexpr (fixed_compare) {
+            return std::memcmp(a.data(), b.data(), (Cap + 1) * sizeof(CharT)) == 0;
+        } else {
+            return a.size() == b.size() &&
+                   std::memcmp(a.data(), b.data(), a.size() * sizeof(CharT)) == 0;
+        }
+    }
+
+    size_type group_mask() const noexcept { return slot_count_ / width - 1; }
+
+    static bool is_full(ctrl_t c) noexcept { return c >= 0; }
+
+    // Slot holding `key`, or npos_slot
+    size_type find_slot(const key_type& key, std::uint64_t hash) const noexcept {
+        if (slot_count_ == 0) return npos_slot;
+
+        const ctrl_t frag = h2(hash);
+        const size_type mask = group_mask();
+        size_type g = static_cast<size_type>(hash >> 7) & mask;
+
+        for (size_type step = 1; ; ++step) {
+            const group grp{ctrl_ + g * width};
+            for (std::uint32_t m = grp.match(frag); m != 0; m &= m - 1) {
+                const size_type idx = g * width + static_cast<size_type>(std::countr_zero(m));
+                if (key_equal(slots_[idx].first, key)) return idx;
+            }
+            if (grp.match_empty() != 0) return npos_slot;
+            g = (g + step) & mask;
+        }
+    }
+
+    // First free slot (empty or deleted) on the probe sequence of `hash`
+    size_type find_free(std::uint64_t hash) const noexcept {
+        const size_type mask = group_mask();
+        size_type g = static_cast<size_type>(hash >> 7) & mask;
+
+        for (size_type step = 1; ; ++step) {
+            const std::uint32_t m = group{ctrl_ + g * width}.match_free();
+            if (m != 0) return g * width + static_cast<size_type>(std::countr_zero(m));
+            g = (g + step) & mask;
+        }
+    }
+
+    static size_type max_load(size_type slots) noexcept {
+        return slots - slots / 8;
+    }
+
+    void allocate(size_type slots) {
+        std::allocator<value_type> alloc;
+        slots_ = alloc_traits::allocate(alloc, slots);
+        ctrl_ = new ctrl_t[slots];
+        std::memset(ctrl_, static_cast<unsigned char>(detail::swiss::ctrl_empty), slots);
+        slot_count_ = slots;
+        growth_left_ = max_load(slots);
+    }
+
+    void deallocate() noexcept {
+        if (slot_count_ == 0) return;
+        std::allocator<value_type> alloc;
+        alloc_traits::deallocate(alloc, slots_, slot_count_);
+        delete[] ctrl_;
+        ctrl_ = nullptr;
+        slots_ = nullptr;
+        slot_count_ = 0;
+        growth_left_ = 0;
+    }
+
+    void destroy_all() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<value_type>) {
+            for (size_type i = 0; i < slot_count_; ++i) {
+                if (is_full(ctrl_[i])) std::destroy_at(slots_ + i);
+            }
+        }
+    }
+
+    void rehash_to(size_type slots) {
+        ctrl_t* old_ctrl = ctrl_;
+        value_type* old_slots = slots_;
+        const size_type old_count = slot_count_;
+
+        slot_count_ = 0;
+        allocate(slots);
+
+        for (size_type i = 0; i < old_count; ++i) {
+            if (!is_full(old_ctrl[i])) continue;
+            value_type& src = old_slots[i];
+            const size_type dst = find_free(hash_of(src.first));
+            ctrl_[dst] = old_ctrl[i];
+            std::construct_at(slots_ + dst, src.first, std::move(src.second));
+            std::destroy_at(&src);
+        }
+        growth_left_ -= size_;
+
+        if (old_count != 0) {
+            std::allocator<value_type> alloc;
+            alloc_traits::deallocate(alloc, old_slots, old_count);
+            delete[] old_ctrl;
+        }
+    }
+
+    static size_type slots_for(size_type elements) noexcept {
+        size_type slots = width;
+        while (max_load(slots) < elements) slots *= 2;
+        return slots;
+    }
+
+    // Make room for one more insertion into an empty slot
+    void prepare_insert() {
+        if (growth_left_ != 0) return;
+        if (slot_count_ == 0) {
+            allocate(width);
+        } else if (size_ <= max_load(slot_count_) / 2) {
+            rehash_to(slot_count_);            // mostly tombstones: clean in place
+        } else {
+            rehash_to(slot_count_ * 2);
+        }
+    }
+
+    static key_type make_key(view_type key) {
+        if (key.size() > Cap) throw std::length_error("fstring_map: key exceeds capacity");
+        return key_type{key.data(), key.size()};
+    }
+
+    template <typename... Args>
+    std::pair<size_type, bool> emplace_slot(view_type key, Args&&... args) {
+        const key_type k = make_key(key);
+        const std::uint64_t hash = hash_of(key);
+
+        if (const size_type idx = find_slot(k, hash); idx != npos_slot) {
+            return {idx, false};
+        }
+
+        prepare_insert();
+        const size_type idx = find_free(hash);
+
+        std::construct_at(slots_ + idx,
+            std::piecewise_construct,
+            std::forward_as_tuple(k),
+            std::forward_as_tuple(std::forward<Args>(args)...));
+        if (ctrl_[idx] == detail::swiss::ctrl_empty) --growth_left_;
+        ctrl_[idx] = h2(hash);
+        ++size_;
+        return {idx, true};
+    }
+
+    size_type lookup(view_type key) const noexcept {
+        if (key.size() > Cap || size_ == 0) return npos_slot;
+        return find_slot(key_type{key.data(), key.size()}, hash_of(key));
+    }
+
+    void erase_slot(size_type idx) noexcept {
+        std::destroy_at(slots_ + idx);
+        --size_;
+
+        // A group that already has an empty slot ends every probe through it,
+        // so the freed slot can become empty instead of a tombstone
+        const size_type g = idx / width;
+        if (group{ctrl_ + g * width}.match_empty() != 0) {
+            ctrl_[idx] = detail::swiss::ctrl_empty;
+            ++growth_left_;
+        } else {
+            ctrl_[idx] = detail::swiss::ctrl_deleted;
+        }
+    }
+
+public:
+    // ==================== Iterators ====================
+
+    template <bool Const>
+    class basic_iterator {
+        friend class basic_fstring_map;
+        template <bool> friend class basic_iterator;
+        using map_ptr = std::conditional_t<Const, const basic_fstring_map*, basic_fstring_map*>;
+
+        map_ptr map_ = nullptr;
+        size_type idx_ = 0;
+
+        constexpr basic_iterator(map_ptr map, size_type idx) noexcept : map_{map}, idx_{idx} {}
+
+        void skip_free() noexcept {
+            while (idx_ < map_->slot_count_ && !is_full(map_->ctrl_[idx_])) ++idx_;
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = basic_fstring_map::value_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<Const, const value_type&, value_type&>;
+        using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+
+        constexpr basic_iterator() noexcept = default;
+
+        // iterator -> const_iterator
+        template <bool C = Const>
+        requires C
+        constexpr basic_iterator(const basic_iterator<false>& other) noexcept
+            : map_{other.map_}, idx_{other.idx_} {}
+
+        reference operator*() const noexcept { return map_->slots_[idx_]; }
+        pointer operator->() const noexcept { return map_->slots_ + idx_; }
+
+        basic_iterator& operator++() noexcept {
+            ++idx_;
+            skip_free();
+            return *this;
+        }
+
+        basic_iterator operator++(int) noexcept {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) noexcept {
+            return a.idx_ == b.idx_;
+        }
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    // ==================== Construction ====================
+
+    basic_fstring_map() noexcept = default;
+
+    explicit basic_fstring_map(size_type expected) { reserve(expected); }
+
+    basic_fstring_map(std::initializer_list<std::pair<view_type, V>> init) {
+        reserve(init.size());
+        for (const auto& [k, v] : init) try_emplace(k, v);
+    }
+
+    basic_fstring_map(const basic_fstring_map& other) {
+        reserve(other.size_);
+        for (const auto& [k, v] : other) try_emplace(k, v);
+    }
+
+    basic_fstring_map(basic_fstring_map&& other) noexcept
+        : ctrl_{std::exchange(other.ctrl_, nullptr)},
+          slots_{std::exchange(other.slots_, nullptr)},
+          slot_count_{std::exchange(other.slot_count_, 0)},
+          size_{std::exchange(other.size_, 0)},
+          growth_left_{std::exchange(other.growth_left_, 0)} {}
+
+    basic_fstring_map& operator=(const basic_fstring_map& other) {
+        if (this != &other) {
+            basic_fstring_map copy{other};
+            swap(copy);
+        }
+        return *this;
+    }
+
+    basic_fstring_map& operator=(basic_fstring_map&& other) noexcept {
+        if (this != &other) {
+            basic_fstring_map moved{std::move(other)};
+            swap(moved);
+        }
+        return *this;
+    }
+
+    ~basic_fstring_map() {
+        destroy_all();
+        deallocate();
+    }
+
+    void swap(basic_fstring_map& other) noexcept {
+        std::swap(ctrl_, other.ctrl_);
+        std::swap(slots_, other.slots_);
+        std::swap(slot_count_, other.slot_count_);
+        std::swap(size_, other.size_);
+        std::swap(growth_left_, other.growth_left_);
+    }
+
+    // ==================== Capacity ====================
+
+    [[nodiscard]] size_type size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+    [[nodiscard]] size_type slot_count() const noexcept { return slot_count_; }
+
+    [[nodiscard]] float load_factor() const noexcept {
+        return slot_count_ == 0 ? 0.0f : static_cast<float>(size_) / static_cast<float>(slot_count_);
+    }
+
+    void reserve(size_type expected) {
+        if (expected == 0) return;
+        const size_type slots = slots_for(expected);
+        if (slots > slot_count_) rehash_to(slots);
+    }
+
+    void clear() noexcept {
+        destroy_all();
+        if (slot_count_ != 0) {
+            std::memset(ctrl_, static_cast<unsigned char>(detail::swiss::ctrl_empty), slot_count_);
+            growth_left_ = max_load(slot_count_);
+        }
+        size_ = 0;
+    }
+
+    // ==================== Iteration ====================
+
+    [[nodiscard]] iterator begin() noexcept {
+        iterator it{this, 0};
+        if (slot_count_ != 0) it.skip_free();
+        return it;
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept {
+        const_iterator it{this, 0};
+        if (slot_count_ != 0) it.skip_free();
+        return it;
+    }
+
+    [[nodiscard]] iterator end() noexcept { return {this, slot_count_}; }
+    [[nodiscard]] const_iterator end() const noexcept { return {this, slot_count_}; }
+    [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+    [[nodiscard]] const_iterator cend() const noexcept { return end(); }
+
+    // ==================== Lookup ====================
+
+    [[nodiscard]] iterator find(view_type key) noexcept {
+        const size_type idx = lookup(key);
+        return idx == npos_slot ? end() : iterator{this, idx};
+    }
+
+    [[nodiscard]] const_iterator find(view_type key) const noexcept {
+        const size_type idx = lookup(key);
+        return idx == npos_slot ? end() : const_iterator{this, idx};
+    }
+
+    [[nodiscard]] bool contains(view_type key) const noexcept {
+        return lookup(key) != npos_slot;
+    }
+
+    [[nodiscard]] size_type count(view_type key) const noexcept {
+        return contains(key) ? 1 : 0;
+    }
+
+    [[nodiscard]] V& at(view_type key) {
+        const size_type idx = lookup(key);
+        if (idx == npos_slot) throw std::out_of_range("fstring_map::at");
+        return slots_[idx].second;
+    }
+
+    [[nodiscard]] const V& at(view_type key) const {
+        const size_type idx = lookup(key);
+        if (idx == npos_slot) throw std::out_of_range("fstring_map::at");
+        return slots_[idx].second;
+    }
+
+    // ==================== Modifiers ====================
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(view_type key, Args&&... args) {
+        const auto [idx, inserted] = emplace_slot(key, std::forward<Args>(args)...);
+        return {iterator{this, idx}, inserted};
+    }
+
+    std::pair<iterator, bool> insert(const std::pair<view_type, V>& kv) {
+        return try_emplace(kv.first, kv.second);
+    }
+
+    template <typename M>
+    std::pair<iterator, bool> insert_or_assign(view_type key, M&& value) {
+        auto result = try_emplace(key, std::forward<M>(value));
+        if (!result.second) result.first->second = std::forward<M>(value);
+        return result;
+    }
+
+    V& operator[](view_type key) {
+        const size_type idx = emplace_slot(key).first;    // may reallocate slots_
+        return slots_[idx].second;
+    }
+
+    size_type erase(view_type key) noexcept {
+        const size_type idx = lookup(key);
+        if (idx == npos_slot) return 0;
+        erase_slot(idx);
+        return 1;
+    }
+
+    iterator erase(const_iterator pos) noexcept {
+        erase_slot(pos.idx_);
+        iterator next{this, pos.idx_};
+        next.skip_free();
+        return next;
+    }
+
+    iterator erase(iterator pos) noexcept {
+        return erase(const_iterator{pos});
+    }
+};
+
+// ==================== Type Aliases ====================
+
+template <std::size_t Cap, typename V>
+using fstring_map = basic_fstring_map<char, Cap, V>;
+
+template <std::size_t Cap, typename V>
+using wfstring_map = basic_fstring_map<wchar_t, Cap, V>;
+
+} // namespace zuu
@@ -0,0 +1,247 @@
+#pragma once
+
+/**
+ * @file zuu/container/intern_pool.hpp
+ * @brief Concurrent string interner handing out stable 32-bit handles
+ * @version 3.0.0
+ *
+ * Design Philosophy:
+ * - Each distinct string is stored once in an append-only arena and named
+ *   by a dense 32-bit id; handle equality and hashing are O(1)
+ * - resolve() is lock-free: arena chunks never move once published
+ * - intern() picks one of `shard_count` shards by hash; hits take only the
+ *   shard's shared lock, misses take it exclusively
+ *
+ * Usage:
+ *   intern_pool<char, 64> names;
+ *   intern_id a = names.intern("alice");
+ *   intern_id b = names.intern(record.name);      // any string-like view
+ *   if (a == b) { ... }                           // integer compare
+ *   std::string_view text = names.view(a);        // lock-free
+ *   auto s = names.stats();                       // hit rate, bytes saved
+ */
+
+#include "../core/core.hpp"
+#include "../core/hash.hpp"
+#include "fstring_map.hpp"
+#include <array>
+#include <atomic>
+#include <bit>
+#include <compare>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string_view>
+
+namespace zuu {
+
+// ==================== Handle ====================
+
+/**
+ * @brief Interned string handle; only meaningful with the pool that made it
+ */
+struct intern_id {
+    static constexpr std::uint32_t invalid = 0xFFFFFFFFu;
+
+    std::uint32_t value = invalid;
+
+    [[nodiscard]] constexpr bool valid() const noexcept { return value != invalid; }
+    [[nodiscard]] constexpr explicit operator bool() const noexcept { return valid(); }
+
+    [[nodiscard]] friend constexpr bool operator==(intern_id, intern_id) noexcept = default;
+    [[nodiscard]] friend constexpr auto operator<=>(intern_id, intern_id) noexcept = default;
+};
+
+// ==================== Statistics ====================
+
+struct intern_stats {
+    std::uint64_t lookups = 0;         // intern() calls
+    std::uint64_t hits = 0;            // calls answered by an existing entry
+    std::uint64_t unique = 0;          // distinct strings stored
+    std::uint64_t arena_bytes = 0;     // bytes reserved for entries
+
+    // Bytes saved by holding handles instead of inline strings, net of the
+    // arena copies: lookups * (sizeof(string) - sizeof(id)) - unique * sizeof(string)
+    std::int64_t bytes_saved = 0;
+
+    [[nodiscard]] constexpr double hit_rate() const noexcept {
+        return lookups == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups);
+    }
+};
+
+// ==================== Intern Pool ====================
+
+/**
+ * @brief Deduplicating arena of basic_fstring<CharT, Cap> values
+ *
+ * Ids are dense and assigned in insertion order. Entry storage grows in
+ * geometric chunks (1024, 2048, ... entries) referenced from a fixed
+ * table, so an id resolves with two loads and no lock. A handle must reach
+ * another thread through normal synchronization (a queue, a mutex, thread
+ * start) before that thread resolves it.
+ */
+template <meta::character CharT, std::size_t Cap>
+class intern_pool {
+public:
+    using value_type = basic_fstring<CharT, Cap>;
+    using view_type = std::basic_string_view<CharT>;
+    using size_type = std::size_t;
+
+    static constexpr size_type shard_count = 16;
+
+private:
+    static constexpr unsigned first_chunk_bits = 10;
+    static constexpr size_type first_chunk = size_type{1} << first_chunk_bits;
+    static constexpr size_type chunk_count = 33 - first_chunk_bits;
+
+    struct alignas(64) shard {
+        mutable std::shared_mutex mutex;
+        basic_fstring_map<CharT, Cap, std::uint32_t> ids;
+        std::atomic<std::uint64_t> lookups{0};
+        std::atomic<std::uint64_t> hits{0};
+    };
+
+    std::array<std::atomic<value_type*>, chunk_count> chunks_{};
+    std::unique_ptr<shard[]> shards_ = std::make_unique<shard[]>(shard_count);
+    std::atomic<std::uint32_t> next_id_{0};
+    std::mutex grow_mutex_;
+
+    // id -> (chunk, offset): chunk k holds first_chunk << k entries
+    static constexpr std::pair<size_type, size_type> locate(std::uint32_t id) noexcept {
+        const size_type x = static_cast<size_type>(id) + first_chunk;
+        const size_type k = static_cast<size_type>(std::bit_width(x)) - 1 - first_chunk_bits;
+        return {k, x - (first_chunk << k)};
+    }
+
+    value_type* chunk_for(size_type k) {
+        if (value_type* c = chunks_[k].load(std::memory_order_acquire)) return c;
+
+        const std::lock_guard lock{grow_mutex_};
+        value_type* c = chunks_[k].load(std::memory_order_relaxed);
+        if (c == nullptr) {
+            c = new value_type[first_chunk << k];
+            chunks_[k].store(c, std::memory_order_release);
+        }
+        return c;
+    }
+
+    static size_type shard_of(std::uint64_t hash) noexcept {
+        return static_cast<size_type>(hash >> 60) & (shard_count - 1);
+    }
+
+public:
+    // ==================== Construction ====================
+
+    intern_pool() = default;
+    intern_pool(const intern_pool&) = delete;
+    intern_pool& operator=(const intern_pool&) = delete;
+
+    ~intern_pool() {
+        for (auto& c : chunks_) delete[] c.load(std::memory_order_relaxed);
+    }
+
+    // ==================== Interning ====================
+
+    /**
+     * @brief Handle of `str`, storing it on first sight
+     *
+     * Throws std::length_error if `str` exceeds Cap or the 32-bit id
+     * space is exhausted.
+     */
+    intern_id intern(view_type str) {
+        if (str.size() > Cap) throw std::length_error("intern_pool: string exceeds capacity");
+
+        shard& s = shards_[shard_of(hash_string(str))];
+        s.lookups.fetch_add(1, std::memory_order_relaxed);
+
+        {
+            const std::shared_lock lock{s.mutex};
+            if (auto it = s.ids.find(str); it != s.ids.end()) {
+                s.hits.fetch_add(1, std::memory_order_relaxed);
+                return {it->second};
+            }
+        }
+
+        const std::unique_lock lock{s.mutex};
+        if (auto it = s.ids.find(str); it != s.ids.end()) {
+            s.hits.fetch_add(1, std::memory_order_relaxed);
+            return {it->second};
+        }
+
+        const std::uint32_t id = next_id_.fetch_add(1, std::memory_order_relaxed);
+        if (id == intern_id::invalid) {
+            next_id_.store(intern_id::invalid, std::memory_order_relaxed);
+            throw std::length_error("intern_pool: id space exhausted");
+        }
+
+        const auto [k, offset] = locate(id);
+        chunk_for(k)[offset] = value_type{str.data(), str.size()};
+        s.ids.try_emplace(str, id);
+        return {id};
+    }
+
+    /**
+     * @brief Handle of `str` if already interned; never inserts
+     */
+    [[nodiscard]] std::optional<intern_id> find(view_type str) const {
+        if (str.size() > Cap) return std::nullopt;
+
+        const shard& s = shards_[shard_of(hash_string(str))];
+        const std::shared_lock lock{s.mutex};
+        if (auto it = s.ids.find(str); it != s.ids.end()) return intern_id{it->second};
+        return std::nullopt;
+    }
+
+    // ==================== Resolution (lock-free) ====================
+
+    [[nodiscard]] const value_type& resolve(intern_id id) const noexcept {
+        const auto [k, offset] = locate(id.value);
+        return chunks_[k].load(std::memory_order_acquire)[offset];
+    }
+
+    [[nodiscard]] view_type view(intern_id id) const noexcept {
+        return resolve(id);
+    }
+
+    // ==================== Observers ====================
+
+    // Number of distinct strings
+    [[nodiscard]] size_type size() const noexcept {
+        return next_id_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] intern_stats stats() const noexcept {
+        intern_stats st;
+        for (size_type i = 0; i < shard_count; ++i) {
+            st.lookups += shards_[i].lookups.load(std::memory_order_relaxed);
+            st.hits += shards_[i].hits.load(std::memory_order_relaxed);
+        }
+        st.unique = size();
+
+        for (size_type k = 0; k < chunk_count; ++k) {
+            if (chunks_[k].load(std::memory_order_relaxed)) {
+                st.arena_bytes += (first_chunk << k) * sizeof(value_type);
+            }
+        }
+
+        const auto per_ref = static_cast<std::int64_t>(sizeof(value_type) - sizeof(intern_id));
+        st.bytes_saved = static_cast<std::int64_t>(st.lookups) * per_ref -
+                         static_cast<std::int64_t>(st.unique * sizeof(value_type));
+        return st;
+    }
+};
+
+} // namespace zuu
+
+// ==================== std::hash ====================
+
+template <>
+struct std::hash<zuu::intern_id> {
+    [[nodiscard]] std::size_t operator()(zuu::intern_id id) const noexcept {
+        // Ids are dense; spread them so low bits stay useful for bucketing
+        return static_cast<std::size_t>(id.value * 0x9E3779B97F4A7C15ull);
+    }
+};
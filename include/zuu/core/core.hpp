@@ -13,8 +13,14 @@
 
 #include "../meta/concepts.hpp"
 #include "../meta/traits.hpp"
+#include "search.hpp"
+#include "simd.hpp"
 #include <algorithm>
+#include <compare>
+#include <cstring>
+#include <limits>
 #include <stdexcept>
+#include <string>
 
 namespace zuu {
 
@@ -37,19 +43,75 @@ public:
     static constexpr size_type capacity = Cap;
     static constexpr size_type npos = static_cast<size_type>(-1);
 
+    /**
+     * Storage layout: when Cap fits in an unsigned code unit, the length is
+     * kept in data_[Cap] as the remaining capacity. A full string stores 0
+     * there, so that slot doubles as its terminator and `fstring<15>` is
+     * exactly 16 bytes. Larger capacities keep an explicit length of the
+     * smallest sufficient width (`fstring<1000>` is 1004 bytes, not 1016).
+     */
+    static constexpr bool size_in_tail =
+        Cap <= static_cast<std::size_t>(std::numeric_limits<std::make_unsigned_t<CharT>>::max());
+
 private:
-    alignas(CharT) CharT data_[Cap + 1]{}; 
-    size_type size_{};
+    struct no_size_field {};
+    using size_field = std::conditional_t<size_in_tail, no_size_field, meta::uint_for_t<Cap>>;
+    using tail_type = std::make_unsigned_t<CharT>;
+
+    alignas(CharT) CharT data_[Cap + 1]{};
+    [[no_unique_address]] size_field size_{};
 
     // Internal helpers
-    constexpr void set_null_terminator() noexcept {
-        data_[size_] = CharT{};
+    constexpr void set_size(size_type n) noexcept {
+        data_[n] = CharT{};
+        if constexpr (size_in_tail) {
+            data_[Cap] = static_cast<CharT>(static_cast<tail_type>(Cap - n));
+        } else {
+            size_ = static_cast<size_field>(n);
+        }
+    }
+
+    // Only [0, size) takes part; bytes past the terminator are never read.
+    // An empty string_view may carry a null data(), which memcmp must not see
+    static constexpr bool equal_data(const_pointer a, const_pointer b, size_type len) noexcept {
+        if (len == 0) return true;
+        if (!std::is_constant_evaluated()) {
+            return std::memcmp(a, b, len * sizeof(CharT)) == 0;
+        }
+        for (size_type i = 0; i < len; ++i) {
+            if (a[i] != b[i]) return false;
+        }
+        return true;
+    }
+
+    // Same order as std::basic_string_view (units compare as char_traits<CharT>::lt)
+    static constexpr std::strong_ordering compare_data(
+        const_pointer a, size_type a_len,
+        const_pointer b, size_type b_len
+    ) noexcept {
+        const size_type len = std::min(a_len, b_len);
+        if (len == 0) return a_len <=> b_len;
+        
+        if (!std::is_constant_evaluated()) {
+            if constexpr (sizeof(CharT) == 1) {
+                const int r = std::memcmp(a, b, len);
+                if (r != 0) return r < 0 ? std::strong_ordering::less : std::strong_ordering::greater;
+            } else {
+                const size_type i = detail::simd::mismatch(a, b, len);
+                if (i != len) return a[i] < b[i] ? std::strong_ordering::less : std::strong_ordering::greater;
+            }
+            return a_len <=> b_len;
+        }
+        
+        const int r = std::char_traits<CharT>::compare(a, b, len);
+        if (r != 0) return r < 0 ? std::strong_ordering::less : std::strong_ordering::greater;
+        return a_len <=> b_len;
     }
 
 public:
     // ==================== Construction ====================
     
-    constexpr basic_fstring() noexcept = default;
+    constexpr basic_fstring() noexcept { set_size(0); }
     constexpr basic_fstring(const basic_fstring&) noexcept = default;
     constexpr basic_fstring(basic_fstring&&) noexcept = default;
     
@@ -58,41 +120,44 @@ public:
     
     ~basic_fstring() = default;
 
+    // From another capacity (truncates when N > Cap, like the other constructors)
+    template <size_type N>
+    requires (N != Cap)
+    constexpr basic_fstring(const basic_fstring<CharT, N>& other) noexcept
+        : basic_fstring(other.data(), other.size()) {}
+
     // From literal
     template <size_type N>
     constexpr basic_fstring(const CharT (&str)[N]) noexcept {
-        size_ = std::min(Cap, N - 1);
-        std::copy_n(str, size_, data_);
-        set_null_terminator();
+        const size_type len = std::min(Cap, N - 1);
+        std::copy_n(str, len, data_);
+        set_size(len);
     }
 
     // From pointer + length
     constexpr basic_fstring(const_pointer str, size_type len) noexcept {
-        if (str) {
-            size_ = std::min(Cap, len);
-            std::copy_n(str, size_, data_);
-            set_null_terminator();
-        }
+        len = str ? std::min(Cap, len) : 0;
+        std::copy_n(str, len, data_);
+        set_size(len);
     }
 
     // From null-terminated string
     constexpr explicit basic_fstring(const_pointer str) noexcept {
+        size_type len = 0;
         if (str) {
-            size_type len = 0;
             while (str[len] != CharT{} && len < Cap) {
                 data_[len] = str[len];
                 ++len;
             }
-            size_ = len;
-            set_null_terminator();
         }
+        set_size(len);
     }
 
     // Fill constructor
     constexpr basic_fstring(size_type count, CharT ch) noexcept {
-        size_ = std::min(Cap, count);
-        std::fill_n(data_, size_, ch);
-        set_null_terminator();
+        count = std::min(Cap, count);
+        std::fill_n(data_, count, ch);
+        set_size(count);
     }
 
     // From string_view
@@ -105,12 +170,18 @@ public:
 
     // ==================== Capacity ====================
     
-    [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
-    [[nodiscard]] constexpr size_type size() const noexcept { return size_; }
-    [[nodiscard]] constexpr size_type length() const noexcept { return size_; }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        if constexpr (size_in_tail) {
+            return Cap - static_cast<size_type>(static_cast<tail_type>(data_[Cap]));
+        } else {
+            return size_;
+        }
+    }
+    [[nodiscard]] constexpr size_type length() const noexcept { return size(); }
     [[nodiscard]] constexpr size_type max_size() const noexcept { return capacity; }
-    [[nodiscard]] constexpr size_type available() const noexcept { return capacity - size_; }
-    [[nodiscard]] constexpr bool full() const noexcept { return size_ == capacity; }
+    [[nodiscard]] constexpr size_type available() const noexcept { return capacity - size(); }
+    [[nodiscard]] constexpr bool full() const noexcept { return size() == capacity; }
 
     // ==================== Element Access ====================
     
@@ -123,19 +194,19 @@ public:
     }
 
     [[nodiscard]] constexpr const_reference at(size_type pos) const {
-        if (pos >= size_) throw std::out_of_range("fstring::at");
+        if (pos >= size()) throw std::out_of_range("fstring::at");
         return data_[pos];
     }
 
     [[nodiscard]] constexpr reference at(size_type pos) {
-        if (pos >= size_) throw std::out_of_range("fstring::at");
+        if (pos >= size()) throw std::out_of_range("fstring::at");
         return data_[pos];
     }
 
     [[nodiscard]] constexpr reference front() noexcept { return data_[0]; }
     [[nodiscard]] constexpr const_reference front() const noexcept { return data_[0]; }
-    [[nodiscard]] constexpr reference back() noexcept { return data_[size_ - 1]; }
-    [[nodiscard]] constexpr const_reference back() const noexcept { return data_[size_ - 1]; }
+    [[nodiscard]] constexpr reference back() noexcept { return data_[size() - 1]; }
+    [[nodiscard]] constexpr const_reference back() const noexcept { return data_[size() - 1]; }
 
     [[nodiscard]] constexpr pointer data() noexcept { return data_; }
     [[nodiscard]] constexpr const_pointer data() const noexcept { return data_; }
@@ -147,47 +218,61 @@ public:
     [[nodiscard]] constexpr const_iterator begin() const noexcept { return data_; }
     [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return data_; }
     
-    [[nodiscard]] constexpr iterator end() noexcept { return data_ + size_; }
-    [[nodiscard]] constexpr const_iterator end() const noexcept { return data_ + size_; }
-    [[nodiscard]] constexpr const_iterator cend() const noexcept { return data_ + size_; }
+    [[nodiscard]] constexpr iterator end() noexcept { return data_ + size(); }
+    [[nodiscard]] constexpr const_iterator end() const noexcept { return data_ + size(); }
+    [[nodiscard]] constexpr const_iterator cend() const noexcept { return data_ + size(); }
 
     // ==================== Modifiers (Core Only) ====================
     
     constexpr void clear() noexcept {
-        size_ = 0;
-        data_[0] = CharT{};
+        set_size(0);
     }
 
     constexpr void push_back(CharT ch) noexcept {
         if (!full()) {
-            data_[size_++] = ch;
-            set_null_terminator();
+            const size_type n = size();
+            data_[n] = ch;
+            set_size(n + 1);
         }
     }
 
     constexpr void pop_back() noexcept {
-        if (size_ > 0) {
-            --size_;
-            set_null_terminator();
+        if (const size_type n = size(); n > 0) {
+            set_size(n - 1);
         }
     }
 
     constexpr void resize(size_type new_size, CharT ch = CharT{}) noexcept {
         new_size = std::min(new_size, capacity);
-        if (new_size > size_) {
-            std::fill(data_ + size_, data_ + new_size, ch);
+        const size_type n = size();
+        if (new_size > n) {
+            std::fill(data_ + n, data_ + new_size, ch);
         }
-        size_ = new_size;
-        set_null_terminator();
+        set_size(new_size);
+    }
+
+    /**
+     * @brief Grow to `count` and let `op(data, count)` write the contents
+     *
+     * Mirrors std::basic_string::resize_and_overwrite: [0, size()) keeps
+     * its contents, `op` returns the final size (at most `count`), and
+     * `count` is clamped to the capacity. Lets callers fill the buffer
+     * with one copy per piece and a single size update.
+     */
+    template <typename Op>
+    constexpr void resize_and_overwrite(size_type count, Op op) {
+        count = std::min(count, capacity);
+        const auto n = static_cast<size_type>(std::move(op)(data_, count));
+        set_size(std::min(n, count));
     }
 
     // Append (basic version)
     constexpr basic_fstring& append(const_pointer str, size_type len) noexcept {
         if (str && !full()) {
-            len = std::min(len, available());
-            std::copy_n(str, len, data_ + size_);
-            size_ += len;
-            set_null_terminator();
+            const size_type n = size();
+            len = std::min(len, capacity - n);
+            std::copy_n(str, len, data_ + n);
+            set_size(n + len);
         }
         return *this;
     }
@@ -198,17 +283,25 @@ public:
     }
 
     constexpr basic_fstring& append(size_type count, CharT ch) noexcept {
-        count = std::min(count, available());
-        std::fill_n(data_ + size_, count, ch);
-        size_ += count;
-        set_null_terminator();
+        const size_type n = size();
+        count = std::min(count, capacity - n);
+        std::fill_n(data_ + n, count, ch);
+        set_size(n + count);
         return *this;
     }
 
 	// ==================== Search Operations ====================
 
 	[[nodiscard]] constexpr size_type find(CharT ch, size_type pos = 0) const noexcept {
-        for (size_type i = pos; i < size_; ++i) {
+        const size_type n = size();
+        if (pos >= n) return npos;
+        
+        if (!std::is_constant_evaluated()) {
+            const size_type idx = detail::simd::find_char(data_ + pos, n - pos, ch);
+            return idx == n - pos ? npos : pos + idx;
+        }
+        
+        for (size_type i = pos; i < n; ++i) {
             if (data_[i] == ch) return i;
         }
         return npos;
@@ -216,30 +309,28 @@ public:
     
     [[nodiscard]] constexpr size_type find(const_pointer str, size_type pos = 0) const noexcept {
         if (!str) return npos;
-        
-        size_type str_len = 0;
-        while (str[str_len] != CharT{}) ++str_len;
-        
-        if (str_len == 0) return pos;
-        if (pos + str_len > size_) return npos;
-        
-        for (size_type i = pos; i <= size_ - str_len; ++i) {
-            bool match = true;
-            for (size_type j = 0; j < str_len; ++j) {
-                if (data_[i + j] != str[j]) {
-                    match = false;
-                    break;
-                }
-            }
-            if (match) return i;
-        }
-        return npos;
+        return find(std::basic_string_view<CharT>{str}, pos);
+    }
+    
+    [[nodiscard]] constexpr size_type find(
+        std::basic_string_view<CharT> str, 
+        size_type pos = 0
+    ) const noexcept {
+        if (str.empty()) return pos;
+        return detail::substring_searcher<CharT>{str.data(), str.size()}.find(data_, size(), pos);
     }
     
     [[nodiscard]] constexpr size_type rfind(CharT ch, size_type pos = npos) const noexcept {
-        if (size_ == 0) return npos;
+        const size_type n = size();
+        if (n == 0) return npos;
+        
+        size_type search_end = (pos >= n) ? n - 1 : pos;
+        
+        if (!std::is_constant_evaluated()) {
+            const size_type idx = detail::simd::rfind_char(data_, search_end + 1, ch);
+            return idx == search_end + 1 ? npos : idx;
+        }
         
-        size_type search_end = (pos >= size_) ? size_ - 1 : pos;
         for (size_type i = search_end + 1; i > 0; --i) {
             if (data_[i - 1] == ch) return i - 1;
         }
@@ -255,21 +346,22 @@ public:
     }
     
     [[nodiscard]] constexpr bool starts_with(CharT ch) const noexcept {
-        return size_ > 0 && data_[0] == ch;
+        return size() > 0 && data_[0] == ch;
     }
     
     [[nodiscard]] constexpr bool starts_with(const_pointer str) const noexcept {
         if (!str) return false;
         size_type i = 0;
         while (str[i] != CharT{}) {
-            if (i >= size_ || data_[i] != str[i]) return false;
+            if (i >= size() || data_[i] != str[i]) return false;
             ++i;
         }
         return true;
     }
     
     [[nodiscard]] constexpr bool ends_with(CharT ch) const noexcept {
-        return size_ > 0 && data_[size_ - 1] == ch;
+        const size_type n = size();
+        return n > 0 && data_[n - 1] == ch;
     }
     
     [[nodiscard]] constexpr bool ends_with(const_pointer str) const noexcept {
@@ -277,10 +369,11 @@ public:
         size_type str_len = 0;
         while (str[str_len] != CharT{}) ++str_len;
         
-        if (str_len > size_) return false;
+        const size_type n = size();
+        if (str_len > n) return false;
         
         for (size_type i = 0; i < str_len; ++i) {
-            if (data_[size_ - str_len + i] != str[i]) return false;
+            if (data_[n - str_len + i] != str[i]) return false;
         }
         return true;
     }
@@ -294,9 +387,10 @@ public:
     ) const noexcept {
         basic_fstring<CharT, ResultCap> result;
         
-        if (pos >= size_) return result;
+        const size_type n = size();
+        if (pos >= n) return result;
         
-        count = std::min(count, size_ - pos);
+        count = std::min(count, n - pos);
         result.append(data_ + pos, count);
         
         return result;
@@ -304,20 +398,33 @@ public:
 
     // ==================== Comparison ====================
     
-    [[nodiscard]] constexpr auto operator<=>(const basic_fstring&) const noexcept = default;
+    // Length-aware: sizes are checked first, then only [0, size) is compared
+    template <std::size_t N>
+    [[nodiscard]] constexpr bool operator==(const basic_fstring<CharT, N>& rhs) const noexcept {
+        return size() == rhs.size() && equal_data(data_, rhs.data(), size());
+    }
+    
+    template <std::size_t N>
+    [[nodiscard]] constexpr std::strong_ordering operator<=>(const basic_fstring<CharT, N>& rhs) const noexcept {
+        return compare_data(data_, size(), rhs.data(), rhs.size());
+    }
     
     [[nodiscard]] constexpr bool operator==(std::basic_string_view<CharT> sv) const noexcept {
-        return std::basic_string_view<CharT>{data_, size_} == sv;
+        return size() == sv.size() && equal_data(data_, sv.data(), size());
+    }
+    
+    [[nodiscard]] constexpr std::strong_ordering operator<=>(std::basic_string_view<CharT> sv) const noexcept {
+        return compare_data(data_, size(), sv.data(), sv.size());
     }
 
     // ==================== Conversions ====================
     
     [[nodiscard]] constexpr operator std::basic_string_view<CharT>() const noexcept {
-        return {data_, size_};
+        return {data_, size()};
     }
 
     [[nodiscard]] constexpr std::basic_string<CharT> to_string() const {
-        return {data_, size_};
+        return {data_, size()};
     }
 
     // ==================== Concatenation ====================
@@ -325,16 +432,16 @@ public:
     template <std::size_t N>
     [[nodiscard]] constexpr auto operator+(const basic_fstring<CharT, N>& rhs) const noexcept {
         basic_fstring<CharT, Cap + N> result;
-        result.append(data_, size_);
+        result.append(data_, size());
         result.append(rhs.data(), rhs.size());
         return result;
     }
 
 	template <std::size_t N>
     [[nodiscard]] constexpr auto operator+(const CharT (&rhs)[N]) const noexcept {
-        basic_fstring<CharT, Cap + N> result;
-        result.append(data_, size_);
-        result.append(rhs, N);
+        basic_fstring<CharT, Cap + N - 1> result;
+        result.append(data_, size());
+        result.append(rhs, N - 1);
         return result;
     }
 
@@ -345,7 +452,7 @@ public:
 
 	template <std::size_t N>
     constexpr basic_fstring& operator+=(const CharT (&rhs)[N]) noexcept {
-        return append(rhs, N);
+        return append(rhs, N - 1);
     }
 
     constexpr basic_fstring& operator+=(CharT ch) noexcept {
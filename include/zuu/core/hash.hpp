@@ -0,0 +1,578 @@
+#pragma once
+
+/**
+ * @file zuu/core/hash.hpp
+ * @brief String hashing: wyhash core, vector bulk path, constexpr twin
+ * @version 3.0.0
+ *
+ * Design Philosophy:
+ * - One algorithm, two readers: the constexpr path assembles little-endian
+ *   bytes from code units, the runtime path loads memory directly; both
+ *   feed the same mixing code, so values are identical
+ * - Inputs up to `bulk_threshold` bytes use wyhash (final v4)
+ * - Longer inputs use 8 x 64-bit stripe accumulators (xxh3-style) with
+ *   AVX2/SSE2 kernels at runtime and an equivalent scalar loop otherwise
+ * - Hashes depend only on the content, so fstrings of any capacity and
+ *   string_views of the same text hash alike (heterogeneous lookup)
+ * - hash_string_icase hashes the ASCII-lowercased text without copying
+ *   it: readers fold each loaded word, so it equals hash_string of the
+ *   lowercased string
+ *
+ * Usage:
+ *   std::unordered_map<fstring<16>, int> plain;                    // std::hash
+ *   std::unordered_map<fstring<16>, int, fstring_hash, fstring_equal> map;
+ *   map.find(std::string_view{"key"});                             // no conversion
+ *   std::unordered_map<fstring<32>, int, fstring_icase_hash, fstring_icase_equal> headers;
+ *   static_assert(hash_string("abc") == hash_string("abc"_fs));
+ */
+
+#include "../meta/concepts.hpp"
+#include "core.hpp"
+#include "simd.hpp"
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string_view>
+
+namespace zuu::detail::hashing {
+
+// ==================== Primitives ====================
+
+inline constexpr std::uint64_t wyp[4] = {
+    0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull,
+    0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull
+};
+
+// 64 x 64 -> 128 multiply; a <- low half, b <- high half
+constexpr void mum(std::uint64_t& a, std::uint64_t& b) noexcept {
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 wide;
+    const wide r = static_cast<wide>(a) * b;
+    a = static_cast<std::uint64_t>(r);
+    b = static_cast<std::uint64_t>(r >> 64);
+#else
+    const std::uint64_t ha = a >> 32, hb = b >> 32;
+    const std::uint64_t la = a & 0xFFFFFFFFull, lb = b & 0xFFFFFFFFull;
+    const std::uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    const std::uint64_t t = rl + (rm0 << 32);
+    std::uint64_t carry = t < rl;
+    const std::uint64_t lo = t + (rm1 << 32);
+    carry += lo < t;
+    a = lo;
+    b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+#endif
+}
+
+constexpr std::uint64_t mix(std::uint64_t a, std::uint64_t b) noexcept {
+    mum(a, b);
+    return a ^ b;
+}
+
+// ==================== Byte Readers ====================
+
+/**
+ * @brief Little-endian byte view of code units (constant evaluation)
+ */
+template <meta::character CharT>
+struct unit_reader {
+    const CharT* units;
+
+    constexpr std::uint64_t byte(std::size_t i) const noexcept {
+        using unit = std::make_unsigned_t<CharT>;
+        const auto u = static_cast<unit>(units[i / sizeof(CharT)]);
+        return static_cast<std::uint64_t>((u >> (8 * (i % sizeof(CharT)))) & 0xFF);
+    }
+
+    constexpr std::uint64_t r8(std::size_t i) const noexcept {
+        std::uint64_t v = 0;
+        for (std::size_t k = 0; k < 8; ++k) v |= byte(i + k) << (8 * k);
+        return v;
+    }
+
+    constexpr std::uint64_t r4(std::size_t i) const noexcept {
+        std::uint64_t v = 0;
+        for (std::size_t k = 0; k < 4; ++k) v |= byte(i + k) << (8 * k);
+        return v;
+    }
+};
+
+/**
+ * @brief Direct unaligned loads (runtime, little-endian hosts)
+ */
+struct memory_reader {
+    const unsigned char* bytes;
+
+    std::uint64_t byte(std::size_t i) const noexcept { return bytes[i]; }
+
+    std::uint64_t r8(std::size_t i) const noexcept {
+        std::uint64_t v;
+        std::memcpy(&v, bytes + i, 8);
+        return v;
+    }
+
+    std::uint64_t r4(std::size_t i) const noexcept {
+        std::uint32_t v;
+        std::memcpy(&v, bytes + i, 4);
+        return v;
+    }
+};
+
+/**
+ * @brief ASCII-lowercase every CharT lane of a little-endian word (SWAR)
+ *
+ * With the lane's top bit masked off, adding 0x80 - 'A' (per 8-bit lane;
+ * scaled for wider units) sets it from 'A' up and adding 0x7F - 'Z' sets
+ * it past 'Z'; lanes where exactly one carried, and whose top bit was
+ * clear, are upper case and gain 0x20.
+ */
+template <meta::character CharT>
+constexpr std::uint64_t ascii_lower_word(std::uint64_t v) noexcept {
+    constexpr unsigned bits = 8 * sizeof(CharT);
+    constexpr std::uint64_t ones = ~std::uint64_t{0} / ((std::uint64_t{1} << bits) - 1);
+    constexpr std::uint64_t top = ones << (bits - 1);
+    constexpr std::uint64_t low = top - ones;
+
+    const std::uint64_t h = v & low;
+    const std::uint64_t from_a = h + (top - ones * 'A');
+    const std::uint64_t past_z = h + (low - ones * 'Z');
+    const std::uint64_t upper = (from_a ^ past_z) & ~v & top;
+    return v | (upper >> (bits - 6));
+}
+
+/**
+ * @brief Reader that lowercases ASCII letters in everything it returns
+ *
+ * Word reads start on unit boundaries (every offset the hash uses is a
+ * multiple of the unit size), so lanes line up with code units.
+ */
+template <meta::character CharT, typename Reader>
+struct ascii_lower_reader {
+    Reader in;
+
+    constexpr std::uint64_t byte(std::size_t i) const noexcept {
+        const std::size_t first = i - i % sizeof(CharT);
+        std::uint64_t u = 0;
+        for (std::size_t k = 0; k < sizeof(CharT); ++k) u |= in.byte(first + k) << (8 * k);
+        return (ascii_lower_word<CharT>(u) >> (8 * (i - first))) & 0xFF;
+    }
+
+    constexpr std::uint64_t r8(std::size_t i) const noexcept {
+        return ascii_lower_word<CharT>(in.r8(i));
+    }
+
+    constexpr std::uint64_t r4(std::size_t i) const noexcept {
+        return ascii_lower_word<CharT>(in.r4(i));
+    }
+};
+
+// ==================== Small / Medium Inputs (wyhash) ====================
+
+template <typename Reader>
+constexpr std::uint64_t wyhash(const Reader& in, std::size_t len, std::uint64_t seed) noexcept {
+    seed ^= mix(seed ^ wyp[0], wyp[1]);
+    std::uint64_t a = 0, b = 0;
+
+    if (len <= 16) {
+        if (len >= 4) {
+            const std::size_t q = (len >> 3) << 2;
+            a = (in.r4(0) << 32) | in.r4(q);
+            b = (in.r4(len - 4) << 32) | in.r4(len - 4 - q);
+        } else if (len > 0) {
+            a = (in.byte(0) << 16) | (in.byte(len >> 1) << 8) | in.byte(len - 1);
+        }
+    } else {
+        std::size_t i = len, p = 0;
+        if (i >= 48) {
+            std::uint64_t see1 = seed, see2 = seed;
+            do {
+                seed = mix(in.r8(p) ^ wyp[1], in.r8(p + 8) ^ seed);
+                see1 = mix(in.r8(p + 16) ^ wyp[2], in.r8(p + 24) ^ see1);
+                see2 = mix(in.r8(p + 32) ^ wyp[3], in.r8(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while (i >= 48);
+            seed ^= see1 ^ see2;
+        }
+        while (i > 16) {
+            seed = mix(in.r8(p) ^ wyp[1], in.r8(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+        a = in.r8(p + i - 16);
+        b = in.r8(p + i - 8);
+    }
+
+    a ^= wyp[1];
+    b ^= seed;
+    mum(a, b);
+    return mix(a ^ wyp[0] ^ len, b ^ wyp[1]);
+}
+
+// ==================== Large Inputs (stripe accumulators) ====================
+
+inline constexpr std::size_t bulk_threshold = 256;    // bytes
+inline constexpr std::size_t stripe_bytes = 64;
+inline constexpr std::size_t block_stripes = 16;
+inline constexpr std::uint64_t scramble_prime = 0x9E3779B1ull;
+
+// Stripe s of a block keys with words [s, s + 8); scrambles use [16, 24)
+inline constexpr auto secret = [] {
+    std::array<std::uint64_t, block_stripes + 8> s{};
+    std::uint64_t x = wyp[2];
+    for (auto& w : s) {
+        // splitmix64
+        x += 0x9E3779B97F4A7C15ull;
+        std::uint64_t z = x;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        w = z ^ (z >> 31);
+    }
+    return s;
+}();
+
+inline constexpr std::size_t last_stripe_key = 11;
+inline constexpr std::size_t merge_key = 3;
+
+template <typename Reader>
+constexpr void accumulate(
+    std::uint64_t (&acc)[8], const Reader& in, std::size_t off, std::size_t key
+) noexcept {
+    for (std::size_t i = 0; i < 8; ++i) {
+        const std::uint64_t data = in.r8(off + 8 * i);
+        const std::uint64_t keyed = data ^ secret[key + i];
+        acc[i ^ 1] += data;
+        acc[i] += (keyed & 0xFFFFFFFFull) * (keyed >> 32);
+    }
+}
+
+constexpr void scramble(std::uint64_t (&acc)[8]) noexcept {
+    for (std::size_t i = 0; i < 8; ++i) {
+        std::uint64_t a = acc[i];
+        a ^= a >> 47;
+        a ^= secret[block_stripes + i];
+        acc[i] = a * scramble_prime;
+    }
+}
+
+#if defined(ZUU_SIMD_AVX2)
+
+inline void accumulate_stripes(
+    std::uint64_t (&acc)[8], const unsigned char* p, std::size_t stripes
+) noexcept {
+    const auto load = [](const void* q) {
+        return _mm256_loadu_si256(static_cast<const __m256i*>(q));
+    };
+    __m256i a0 = load(acc), a1 = load(acc + 4);
+    const __m256i prime = _mm256_set1_epi64x(static_cast<long long>(scramble_prime));
+
+    for (std::size_t s = 0; s < stripes; ++s) {
+        const std::size_t key = s % block_stripes;
+        const __m256i d0 = load(p + s * stripe_bytes);
+        const __m256i d1 = load(p + s * stripe_bytes + 32);
+        const __m256i k0 = _mm256_xor_si256(d0, load(secret.data() + key));
+        const __m256i k1 = _mm256_xor_si256(d1, load(secret.data() + key + 4));
+        a0 = _mm256_add_epi64(a0, _mm256_add_epi64(
+            _mm256_mul_epu32(k0, _mm256_srli_epi64(k0, 32)),
+            _mm256_shuffle_epi32(d0, _MM_SHUFFLE(1, 0, 3, 2))));
+        a1 = _mm256_add_epi64(a1, _mm256_add_epi64(
+            _mm256_mul_epu32(k1, _mm256_srli_epi64(k1, 32)),
+            _mm256_shuffle_epi32(d1, _MM_SHUFFLE(1, 0, 3, 2))));
+
+        if (key == block_stripes - 1) {
+            const auto scr = [&](__m256i a, const std::uint64_t* k) {
+                a = _mm256_xor_si256(a, _mm256_srli_epi64(a, 47));
+                a = _mm256_xor_si256(a, load(k));
+                const __m256i lo = _mm256_mul_epu32(a, prime);
+                const __m256i hi = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), prime);
+                return _mm256_add_epi64(lo, _mm256_slli_epi64(hi, 32));
+            };
+            a0 = scr(a0, secret.data() + block_stripes);
+            a1 = scr(a1, secret.data() + block_stripes + 4);
+        }
+    }
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc), a0);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc + 4), a1);
+}
+
+#elif defined(ZUU_SIMD_SSE2)
+
+inline void accumulate_stripes(
+    std::uint64_t (&acc)[8], const unsigned char* p, std::size_t stripes
+) noexcept {
+    const auto load = [](const void* q) {
+        return _mm_loadu_si128(static_cast<const __m128i*>(q));
+    };
+    __m128i a[4];
+    for (std::size_t j = 0; j < 4; ++j) a[j] = load(acc + 2 * j);
+    const __m128i prime = _mm_set1_epi64x(static_cast<long long>(scramble_prime));
+
+    for (std::size_t s = 0; s < stripes; ++s) {
+        const std::size_t key = s % block_stripes;
+        for (std::size_t j = 0; j < 4; ++j) {
+            const __m128i d = load(p + s * stripe_bytes + 16 * j);
+            const __m128i k = _mm_xor_si128(d, load(secret.data() + key + 2 * j));
+            a[j] = _mm_add_epi64(a[j], _mm_add_epi64(
+                _mm_mul_epu32(k, _mm_srli_epi64(k, 32)),
+                _mm_shuffle_epi32(d, _MM_SHUFFLE(1, 0, 3, 2))));
+        }
+
+        if (key == block_stripes - 1) {
+            for (std::size_t j = 0; j < 4; ++j) {
+                __m128i v = _mm_xor_si128(a[j], _mm_srli_epi64(a[j], 47));
+                v = _mm_xor_si128(v, load(secret.data() + block_stripes + 2 * j));
+                const __m128i lo = _mm_mul_epu32(v, prime);
+                const __m128i hi = _mm_mul_epu32(_mm_srli_epi64(v, 32), prime);
+                a[j] = _mm_add_epi64(lo, _mm_slli_epi64(hi, 32));
+            }
+        }
+    }
+
+    for (std::size_t j = 0; j < 4; ++j) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(acc + 2 * j), a[j]);
+    }
+}
+
+#endif
+
+#if defined(ZUU_SIMD_AVX2) || defined(ZUU_SIMD_SSE2)
+
+// Lowercase one block (16 stripes) at a time into a buffer with the
+// vector case kernel, then run the stripe kernel over it. Whole blocks
+// keep the stripe keys and scramble points where a single call puts them
+template <meta::character CharT>
+inline void accumulate_lowered(
+    std::uint64_t (&acc)[8], const ascii_lower_reader<CharT, memory_reader>& in, std::size_t stripes
+) noexcept {
+    constexpr std::size_t block_bytes = stripe_bytes * block_stripes;
+    alignas(32) CharT buf[block_bytes / sizeof(CharT)];
+    for (std::size_t s = 0; s < stripes; s += block_stripes) {
+        const std::size_t n = stripes - s < block_stripes ? stripes - s : block_stripes;
+        const auto* src = reinterpret_cast<const CharT*>(in.in.bytes + s * stripe_bytes);
+        simd::ascii_case_convert<simd::ascii_case::lower>(src, n * stripe_bytes / sizeof(CharT), buf);
+        accumulate_stripes(acc, reinterpret_cast<const unsigned char*>(buf), n);
+    }
+}
+
+#endif
+
+template <typename Reader>
+constexpr std::uint64_t bulk(const Reader& in, std::size_t len, std::uint64_t seed) noexcept {
+    std::uint64_t acc[8];
+    for (std::size_t i = 0; i < 8; ++i) acc[i] = secret[i] ^ seed;
+
+    // Every full stripe except the last; the final 64 bytes are taken as an
+    // overlapping stripe so the tail needs no padding
+    const std::size_t stripes = (len - 1) / stripe_bytes;
+
+#if defined(ZUU_SIMD_AVX2) || defined(ZUU_SIMD_SSE2)
+    if constexpr (std::is_same_v<Reader, memory_reader>) {
+        accumulate_stripes(acc, in.bytes, stripes);
+    } else if constexpr (requires { accumulate_lowered(acc, in, stripes); }) {
+        accumulate_lowered(acc, in, stripes);
+    } else
+#endif
+    {
+        for (std::size_t s = 0; s < stripes; ++s) {
+            accumulate(acc, in, s * stripe_bytes, s % block_stripes);
+            if (s % block_stripes == block_stripes - 1) scramble(acc);
+        }
+    }
+    accumulate(acc, in, len - stripe_bytes, last_stripe_key);
+
+    std::uint64_t h = len * wyp[0] ^ seed;
+    for (std::size_t j = 0; j < 4; ++j) {
+        h += mix(acc[2 * j] ^ secret[merge_key + 2 * j], acc[2 * j + 1] ^ secret[merge_key + 2 * j + 1]);
+    }
+    return mix(h ^ wyp[2], wyp[3] ^ len);
+}
+
+template <typename Reader>
+constexpr std::uint64_t hash(const Reader& in, std::size_t len, std::uint64_t seed) noexcept {
+    return len <= bulk_threshold ? wyhash(in, len, seed) : bulk(in, len, seed);
+}
+
+} // namespace zuu::detail::hashing
+
+namespace zuu {
+
+// ==================== Hash Functions ====================
+
+/**
+ * @brief 64-bit hash of a code unit sequence
+ *
+ * Identical at compile time and at runtime. Wide code units are hashed as
+ * their little-endian bytes, independent of the host byte order.
+ */
+template <meta::character CharT>
+[[nodiscard]] constexpr std::uint64_t hash_string(
+    std::basic_string_view<CharT> str,
+    std::uint64_t seed = 0
+) noexcept {
+    const std::size_t len = str.size() * sizeof(CharT);
+
+    if constexpr (std::endian::native == std::endian::little) {
+        if (!std::is_constant_evaluated()) {
+            const detail::hashing::memory_reader in{
+                reinterpret_cast<const unsigned char*>(str.data())};
+            return detail::hashing::hash(in, len, seed);
+        }
+    }
+    return detail::hashing::hash(detail::hashing::unit_reader<CharT>{str.data()}, len, seed);
+}
+
+template <meta::character CharT, std::size_t Cap>
+[[nodiscard]] constexpr std::uint64_t hash_string(
+    const basic_fstring<CharT, Cap>& str,
+    std::uint64_t seed = 0
+) noexcept {
+    return hash_string(std::basic_string_view<CharT>{str}, seed);
+}
+
+template <meta::character CharT, std::size_t N>
+[[nodiscard]] constexpr std::uint64_t hash_string(
+    const CharT (&str)[N],
+    std::uint64_t seed = 0
+) noexcept {
+    return hash_string(std::basic_string_view<CharT>{str, N - 1}, seed);
+}
+
+/**
+ * @brief hash_string of the ASCII-lowercased text, without the copy
+ *
+ * Consistent with case-insensitive equality: strings that differ only in
+ * the case of ASCII letters hash alike.
+ */
+template <meta::character CharT>
+[[nodiscard]] constexpr std::uint64_t hash_string_icase(
+    std::basic_string_view<CharT> str,
+    std::uint64_t seed = 0
+) noexcept {
+    using detail::hashing::ascii_lower_reader;
+    const std::size_t len = str.size() * sizeof(CharT);
+
+    if constexpr (std::endian::native == std::endian::little) {
+        if (!std::is_constant_evaluated()) {
+            const ascii_lower_reader<CharT, detail::hashing::memory_reader> in{
+                {reinterpret_cast<const unsigned char*>(str.data())}};
+            return detail::hashing::hash(in, len, seed);
+        }
+    }
+    const ascii_lower_reader<CharT, detail::hashing::unit_reader<CharT>> in{{str.data()}};
+    return detail::hashing::hash(in, len, seed);
+}
+
+template <meta::character CharT, std::size_t Cap>
+[[nodiscard]] constexpr std::uint64_t hash_string_icase(
+    const basic_fstring<CharT, Cap>& str,
+    std::uint64_t seed = 0
+) noexcept {
+    return hash_string_icase(std::basic_string_view<CharT>{str}, seed);
+}
+
+template <meta::character CharT, std::size_t N>
+[[nodiscard]] constexpr std::uint64_t hash_string_icase(
+    const CharT (&str)[N],
+    std::uint64_t seed = 0
+) noexcept {
+    return hash_string_icase(std::basic_string_view<CharT>{str, N - 1}, seed);
+}
+
+// ==================== Transparent Functors ====================
+
+/**
+ * @brief Heterogeneous hash for unordered containers keyed by fstrings
+ *
+ * Accepts any fstring capacity, string_view, std::string or C string of
+ * the same character type and hashes the content only.
+ */
+template <meta::character CharT>
+struct basic_fstring_hash {
+    using is_transparent = void;
+
+    [[nodiscard]] constexpr std::size_t operator()(std::basic_string_view<CharT> str) const noexcept {
+        return static_cast<std::size_t>(hash_string(str));
+    }
+
+    template <std::size_t Cap>
+    [[nodiscard]] constexpr std::size_t operator()(const basic_fstring<CharT, Cap>& str) const noexcept {
+        return static_cast<std::size_t>(hash_string(str));
+    }
+};
+
+/**
+ * @brief Heterogeneous equality matching basic_fstring_hash
+ */
+template <meta::character CharT>
+struct basic_fstring_equal {
+    using is_transparent = void;
+
+    [[nodiscard]] constexpr bool operator()(
+        std::basic_string_view<CharT> lhs,
+        std::basic_string_view<CharT> rhs
+    ) const noexcept {
+        return lhs == rhs;
+    }
+};
+
+/**
+ * @brief ASCII case-insensitive counterparts for unordered containers
+ *        (HTTP header names, SQL identifiers)
+ */
+template <meta::character CharT>
+struct basic_fstring_icase_hash {
+    using is_transparent = void;
+
+    [[nodiscard]] constexpr std::size_t operator()(std::basic_string_view<CharT> str) const noexcept {
+        return static_cast<std::size_t>(hash_string_icase(str));
+    }
+
+    template <std::size_t Cap>
+    [[nodiscard]] constexpr std::size_t operator()(const basic_fstring<CharT, Cap>& str) const noexcept {
+        return static_cast<std::size_t>(hash_string_icase(str));
+    }
+};
+
+template <meta::character CharT>
+struct basic_fstring_icase_equal {
+    using is_transparent = void;
+
+    [[nodiscard]] constexpr bool operator()(
+        std::basic_string_view<CharT> lhs,
+        std::basic_string_view<CharT> rhs
+    ) const noexcept {
+        if (lhs.size() != rhs.size()) return false;
+        if (!std::is_constant_evaluated()) {
+            return detail::simd::mismatch_ignore_case(lhs.data(), rhs.data(), lhs.size()) == lhs.size();
+        }
+        constexpr auto lower = detail::simd::ascii_case::lower;
+        for (std::size_t i = 0; i < lhs.size(); ++i) {
+            if (detail::simd::ascii_case_unit<lower>(lhs[i]) != detail::simd::ascii_case_unit<lower>(rhs[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+using fstring_hash = basic_fstring_hash<char>;
+using wfstring_hash = basic_fstring_hash<wchar_t>;
+using fstring_equal = basic_fstring_equal<char>;
+using wfstring_equal = basic_fstring_equal<wchar_t>;
+using fstring_icase_hash = basic_fstring_icase_hash<char>;
+using wfstring_icase_hash = basic_fstring_icase_hash<wchar_t>;
+using fstring_icase_equal = basic_fstring_icase_equal<char>;
+using wfstring_icase_equal = basic_fstring_icase_equal<wchar_t>;
+
+} // namespace zuu
+
+// ==================== std::hash ====================
+
+template <zuu::meta::character CharT, std::size_t Cap>
+struct std::hash<zuu::basic_fstring<CharT, Cap>> {
+    [[nodiscard]] std::size_t operator()(const zuu::basic_fstring<CharT, Cap>& str) const noexcept {
+        return static_cast<std::size_t>(zuu::hash_string(str));
+    }
+};
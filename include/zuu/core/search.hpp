@@ -0,0 +1,215 @@
+#pragma once
+
+/**
+ * @file zuu/core/search.hpp
+ * @brief Substring search engine (Two-Way + vector filter)
+ * @version 3.0.0
+ *
+ * Design Philosophy:
+ * - Needle is analysed once, then reused for any number of scans
+ * - Linear worst case: Crochemore-Perrin Two-Way, constexpr-friendly
+ * - Short needles at runtime use the first/last unit filter in simd.hpp
+ * - IgnoreCase compares units after ASCII lowercasing, in the Two-Way
+ *   factorization and in the vector paths alike
+ */
+
+#include "../meta/concepts.hpp"
+#include "simd.hpp"
+#include <cstddef>
+
+namespace zuu::detail {
+
+// ==================== Two-Way Substring Searcher ====================
+
+/**
+ * @brief Precomputed substring searcher over a borrowed needle
+ *
+ * The needle is not copied and must outlive the searcher.
+ *
+ * Usage:
+ *   substring_searcher<char> s{"needle", 6};
+ *   std::size_t pos = s.find(hay, hay_len);       // npos if absent
+ *   std::size_t next = s.find(hay, hay_len, pos + 6);
+ *   substring_searcher<char, true> h{"Content-Type", 12};   // ASCII case-insensitive
+ */
+template <meta::character CharT, bool IgnoreCase = false>
+class substring_searcher {
+public:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+private:
+    using index = std::ptrdiff_t;
+
+    const CharT* needle_ = nullptr;
+    index len_ = 0;
+    index ell_ = -1;       // critical position
+    index period_ = 1;
+    bool periodic_ = false;
+
+    static constexpr CharT unit(CharT ch) noexcept {
+        if constexpr (IgnoreCase) {
+            return simd::ascii_case_unit<simd::ascii_case::lower>(ch);
+        } else {
+            return ch;
+        }
+    }
+
+    static constexpr void maximal_suffix(
+        const CharT* x, index m, bool reversed, index& pos, index& period
+    ) noexcept {
+        index ms = -1, j = 0, k = 1, p = 1;
+        while (j + k < m) {
+            const CharT a = unit(x[j + k]);
+            const CharT b = unit(x[ms + k]);
+            if (reversed ? (b < a) : (a < b)) {
+                j += k;
+                k = 1;
+                p = j - ms;
+            } else if (a == b) {
+                if (k != p) {
+                    ++k;
+                } else {
+                    j += p;
+                    k = 1;
+                }
+            } else {
+                ms = j;
+                j = ms + 1;
+                k = p = 1;
+            }
+        }
+        pos = ms;
+        period = p;
+    }
+
+    constexpr std::size_t find_two_way(const CharT* hay, index n) const noexcept {
+        const CharT* x = needle_;
+        const index m = len_;
+
+        if (periodic_) {
+            index j = 0;
+            index memory = -1;
+            while (j <= n - m) {
+                index i = (ell_ > memory ? ell_ : memory) + 1;
+                while (i < m && unit(x[i]) == unit(hay[i + j])) ++i;
+                if (i >= m) {
+                    i = ell_;
+                    while (i > memory && unit(x[i]) == unit(hay[i + j])) --i;
+                    if (i <= memory) return static_cast<std::size_t>(j);
+                    j += period_;
+                    memory = m - period_ - 1;
+                } else {
+                    j += i - ell_;
+                    memory = -1;
+                }
+            }
+        } else {
+            index j = 0;
+            while (j <= n - m) {
+                index i = ell_ + 1;
+                while (i < m && unit(x[i]) == unit(hay[i + j])) ++i;
+                if (i >= m) {
+                    i = ell_;
+                    while (i >= 0 && unit(x[i]) == unit(hay[i + j])) --i;
+                    if (i < 0) return static_cast<std::size_t>(j);
+                    j += period_;
+                } else {
+                    j += i - ell_;
+                }
+            }
+        }
+        return npos;
+    }
+
+    // Vector paths for needles of up to filter_max_needle units
+    std::size_t scan(const CharT* first, std::size_t count) const noexcept {
+        const auto m = static_cast<std::size_t>(len_);
+        if constexpr (IgnoreCase) {
+            return m == 1 ? simd::find_char_ignore_case(first, count, needle_[0])
+                          : simd::find_substr_ignore_case(first, count, needle_, m);
+        } else {
+            return m == 1 ? simd::find_char(first, count, needle_[0])
+                          : simd::find_substr(first, count, needle_, m);
+        }
+    }
+
+public:
+    constexpr substring_searcher() noexcept = default;
+
+    constexpr substring_searcher(const CharT* needle, std::size_t len) noexcept
+        : needle_{needle}, len_{static_cast<index>(len)} {
+        if (len_ < 2) return;
+
+        index i_pos, i_per, j_pos, j_per;
+        maximal_suffix(needle_, len_, false, i_pos, i_per);
+        maximal_suffix(needle_, len_, true, j_pos, j_per);
+
+        if (i_pos > j_pos) {
+            ell_ = i_pos;
+            period_ = i_per;
+        } else {
+            ell_ = j_pos;
+            period_ = j_per;
+        }
+
+        // Needle is periodic iff x[0..ell] == x[per..per+ell]
+        periodic_ = period_ + ell_ + 1 <= len_;
+        for (index k = 0; periodic_ && k <= ell_; ++k) {
+            if (unit(needle_[k]) != unit(needle_[period_ + k])) periodic_ = false;
+        }
+
+        if (!periodic_) {
+            const index left = ell_ + 1;
+            const index right = len_ - ell_ - 1;
+            period_ = (left > right ? left : right) + 1;
+        }
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept {
+        return static_cast<std::size_t>(len_);
+    }
+
+    /**
+     * @brief First occurrence at or after `pos` in [hay, hay + n), or npos
+     */
+    [[nodiscard]] constexpr std::size_t find(
+        const CharT* hay, std::size_t n, std::size_t pos = 0
+    ) const noexcept {
+        const auto m = static_cast<std::size_t>(len_);
+        if (pos > n || m > n - pos) return npos;
+        if (m == 0) return pos;
+
+        const CharT* first = hay + pos;
+        const std::size_t count = n - pos;
+
+        if (!std::is_constant_evaluated() && m <= simd::filter_max_needle) {
+            const std::size_t idx = scan(first, count);
+            return idx == count ? npos : pos + idx;
+        }
+
+        const std::size_t idx = find_two_way(first, static_cast<index>(count));
+        return idx == npos ? npos : pos + idx;
+    }
+
+    /**
+     * @brief Number of non-overlapping occurrences in [hay, hay + n)
+     */
+    [[nodiscard]] constexpr std::size_t count(const CharT* hay, std::size_t n) const noexcept {
+        const auto m = static_cast<std::size_t>(len_);
+        if (m == 0) return 0;
+
+        std::size_t cnt = 0;
+        for (std::size_t pos = find(hay, n); pos != npos; pos = find(hay, n, pos + m)) {
+            ++cnt;
+        }
+        return cnt;
+    }
+};
+
+template <meta::character CharT>
+substring_searcher(const CharT*, std::size_t) -> substring_searcher<CharT>;
+
+template <meta::character CharT>
+using substring_searcher_icase = substring_searcher<CharT, true>;
+
+} // namespace zuu::detail
@@ -0,0 +1,1228 @@
+#pragma once
+
+/**
+ * @file zuu/core/simd.hpp
+ * @brief Runtime vector kernels used by the core search operations
+ * @version 3.0.0
+ *
+ * Design Philosophy:
+ * - Runtime only: callers keep a constexpr loop for constant evaluation
+ * - Lane width follows sizeof(CharT) (8/16/32-bit code units)
+ * - AVX2 -> SSE2 -> scalar, selected at compile time from target macros
+ * - Search kernels never read outside [first, first + count); the
+ *   fixed-width digit reader (read_digits16) instead needs its whole
+ *   window readable and leaves that check to its caller
+ */
+
+#include "../meta/concepts.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__AVX2__)
+    #define ZUU_SIMD_AVX2 1
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define ZUU_SIMD_SSE2 1
+#endif
+
+#if defined(__SSSE3__) || defined(__AVX__)
+    #define ZUU_SIMD_SSSE3 1
+#endif
+
+#if defined(ZUU_SIMD_AVX2) || defined(ZUU_SIMD_SSE2)
+    #include <immintrin.h>
+#endif
+
+namespace zuu::detail::simd {
+
+// ==================== Lane Helpers ====================
+
+template <meta::character CharT>
+inline constexpr bool is_lane_char =
+    sizeof(CharT) == 1 || sizeof(CharT) == 2 || sizeof(CharT) == 4;
+
+#if defined(ZUU_SIMD_SSE2)
+
+template <meta::character CharT>
+inline __m128i splat128(CharT ch) noexcept {
+    if constexpr (sizeof(CharT) == 1) {
+        return _mm_set1_epi8(static_cast<char>(ch));
+    } else if constexpr (sizeof(CharT) == 2) {
+        return _mm_set1_epi16(static_cast<short>(ch));
+    } else {
+        return _mm_set1_epi32(static_cast<int>(ch));
+    }
+}
+
+template <meta::character CharT>
+inline __m128i cmpeq128(__m128i a, __m128i b) noexcept {
+    if constexpr (sizeof(CharT) == 1) {
+        return _mm_cmpeq_epi8(a, b);
+    } else if constexpr (sizeof(CharT) == 2) {
+        return _mm_cmpeq_epi16(a, b);
+    } else {
+        return _mm_cmpeq_epi32(a, b);
+    }
+}
+
+template <meta::character CharT>
+inline __m128i sub128(__m128i a, __m128i b) noexcept {
+    if constexpr (sizeof(CharT) == 1) {
+        return _mm_sub_epi8(a, b);
+    } else if constexpr (sizeof(CharT) == 2) {
+        return _mm_sub_epi16(a, b);
+    } else {
+        return _mm_sub_epi32(a, b);
+    }
+}
+
+// Signed lane compare a > b
+template <meta::character CharT>
+inline __m128i cmpgt128(__m128i a, __m128i b) noexcept {
+    if constexpr (sizeof(CharT) == 1) {
+        return _mm_cmpgt_epi8(a, b);
+    } else if constexpr (sizeof(CharT) == 2) {
+        return _mm_cmpgt_epi16(a, b);
+    } else {
+        return _mm_cmpgt_epi32(a, b);
+    }
+}
+
+template <meta::character CharT>
+inline __m128i load128(const CharT* p) noexcept {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+template <meta::character CharT>
+inline void store128(CharT* p, __m128i v) noexcept {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+}
+
+#endif // ZUU_SIMD_SSE2
+
+#if defined(ZUU_SIMD_AVX2)
+
+template <meta::character CharT>
+inline __m256i splat256(CharT ch) noexcept {
+    if constexpr (sizeof(CharT) == 1) {
+        return _mm256_set1_epi8(static_cast<char>(ch));
+    } else if constexpr (sizeof(CharT) == 2) {
+        return _mm256_set1_epi16(static_cast<short>(ch));
+    } else {
+        return _mm256_set1_epi32(static_cast<int>(ch));
+    }
+}
+
+template <meta::character CharT>
+inline __m256i cmpeq256(__m256i a, __m256i b) noexcept {
+    if constexpr (sizeof(CharT) == 1) {
+        return _mm256_cmpeq_epi8(a, b);
+    } else if constexpr (sizeof(CharT) == 2) {
+        return _mm256_cmpeq_epi16(a, b);
+    } else {
+        return _mm256_cmpeq_epi32(a, b);
+    }
+}
+
+template <meta::character CharT>
+inline __m256i sub256(__m256i a, __m256i b) noexcept {
+    if constexpr (sizeof(CharT) == 1) {
+        return _mm256_sub_epi8(a, b);
+    } else if constexpr (sizeof(CharT) == 2) {
+        return _mm256_sub_epi16(a, b);
+    } else {
+        return _mm256_sub_epi32(a, b);
+    }
+}
+
+template <meta::character CharT>
+inline __m256i cmpgt256(__m256i a, __m256i b) noexcept {
+    if constexpr (sizeof(CharT) == 1) {
+        return _mm256_cmpgt_epi8(a, b);
+    } else if constexpr (sizeof(CharT) == 2) {
+        return _mm256_cmpgt_epi16(a, b);
+    } else {
+        return _mm256_cmpgt_epi32(a, b);
+    }
+}
+
+template <meta::character CharT>
+inline __m256i load256(const CharT* p) noexcept {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
+
+template <meta::character CharT>
+inline void store256(CharT* p, __m256i v) noexcept {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+}
+
+#endif // ZUU_SIMD_AVX2
+
+// Movemask produces one bit per byte; convert a bit index to a lane index
+template <meta::character CharT>
+inline std::size_t first_lane(std::uint32_t mask) noexcept {
+    return static_cast<std::size_t>(std::countr_zero(mask)) / sizeof(CharT);
+}
+
+template <meta::character CharT>
+inline std::size_t last_lane(std::uint32_t mask) noexcept {
+    return static_cast<std::size_t>(31 - std::countl_zero(mask)) / sizeof(CharT);
+}
+
+// ==================== Find Character ====================
+
+/**
+ * @brief Index of the first `ch` in [first, first + count), or `count`
+ */
+template <meta::character CharT>
+inline std::size_t find_char(const CharT* first, std::size_t count, CharT ch) noexcept {
+    std::size_t i = 0;
+
+#if defined(ZUU_SIMD_AVX2)
+    if constexpr (is_lane_char<CharT>) {
+        constexpr std::size_t lanes = 32 / sizeof(CharT);
+        const __m256i needle = splat256(ch);
+        for (; i + lanes <= count; i += lanes) {
+            const auto eq = cmpeq256<CharT>(load256(first + i), needle);
+            const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(eq));
+            if (mask != 0) return i + first_lane<CharT>(mask);
+        }
+    }
+#endif
+
+#if defined(ZUU_SIMD_SSE2)
+    if constexpr (is_lane_char<CharT>) {
+        constexpr std::size_t lanes = 16 / sizeof(CharT);
+        const __m128i needle = splat128(ch);
+        for (; i + lanes <= count; i += lanes) {
+            const auto eq = cmpeq128<CharT>(load128(first + i), needle);
+            const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(eq));
+            if (mask != 0) return i + first_lane<CharT>(mask);
+        }
+    }
+#else
+    if constexpr (sizeof(CharT) == 1) {
+        // Baseline: the C library's memchr is vectorized on every mainstream libc
+        const void* hit = std::memchr(first, static_cast<unsigned char>(ch), count);
+        return hit ? static_cast<std::size_t>(static_cast<const CharT*>(hit) - first) : count;
+    }
+#endif
+
+    for (; i < count; ++i) {
+        if (first[i] == ch) return i;
+    }
+    return count;
+}
+
+/**
+ * @brief Index of the last `ch` in [first, first + count), or `count`
+ */
+template <meta::character CharT>
+inline std::size_t rfind_char(const CharT* first, std::size_t count, CharT ch) noexcept {
+    std::size_t i = count;
+
+#if defined(ZUU_SIMD_AVX2)
+    if constexpr (is_lane_char<CharT>) {
+        constexpr std::size_t lanes = 32 / sizeof(CharT);
+        const __m256i needle = splat256(ch);
+        for (; i >= lanes; i -= lanes) {
+            const auto eq = cmpeq256<CharT>(load256(first + i - lanes), needle);
+            const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(eq));
+            if (mask != 0) return i - lanes + last_lane<CharT>(mask);
+        }
+    }
+#endif
+
+#if defined(ZUU_SIMD_SSE2)
+    if constexpr (is_lane_char<CharT>) {
+        constexpr std::size_t lanes = 16 / sizeof(CharT);
+        const __m128i needle = splat128(ch);
+        for (; i >= lanes; i -= lanes) {
+            const auto eq = cmpeq128<CharT>(load128(first + i - lanes), needle);
+            const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(eq));
+            if (mask != 0) return i - lanes + last_lane<CharT>(mask);
+        }
+    }
+#elif defined(__GLIBC__)
+    if constexpr (sizeof(CharT) == 1) {
+        const void* hit = ::memrchr(first, static_cast<unsigned char>(ch), count);
+        return hit ? static_cast<std::size_t>(static_cast<const CharT*>(hit) - first) : count;
+    }
+#endif
+
+    for (; i > 0; --i) {
+        if (first[i - 1] == ch) return i - 1;
+    }
+    return count;
+}
+
+// ==================== Find Substring ====================
+
+/**
+ * @brief Longest needle handled by the first/last code unit filter
+ *
+ * Every candidate costs at most one compare of the needle, so bounding
+ * the needle keeps the filter linear in the haystack length. Longer
+ * needles go through the Two-Way engine in search.hpp.
+ */
+inline constexpr std::size_t filter_max_needle = 32;
+
+/**
+ * @brief Index of `needle` in [first, first + count), or `count`
+ *
+ * Vector "first + last code unit" filter: candidates are positions where
+ * both the first and the last needle unit match, then the middle is
+ * verified with memcmp. Requires 2 <= len <= count.
+ */
+template <meta::character CharT>
+inline std::size_t find_substr(
+    const CharT* first, std::size_t count,
+    const CharT* needle, std::size_t len
+) noexcept {
+    std::size_t i = 0;
+    const std::size_t last_off = len - 1;
+    const std::size_t mid_bytes = (len - 2) * sizeof(CharT);
+
+    [[maybe_unused]] constexpr std::uint32_t lane_bits = (1u << sizeof(CharT)) - 1;
+
+#if defined(ZUU_SIMD_AVX2)
+    if constexpr (is_lane_char<CharT>) {
+        constexpr std::size_t lanes = 32 / sizeof(CharT);
+        const __m256i head = splat256(needle[0]);
+        const __m256i tail = splat256(needle[last_off]);
+        for (; i + last_off + lanes <= count; i += lanes) {
+            const auto eq_head = cmpeq256<CharT>(load256(first + i), head);
+            const auto eq_tail = cmpeq256<CharT>(load256(first + i + last_off), tail);
+            auto mask = static_cast<std::uint32_t>(
+                _mm256_movemask_epi8(_mm256_and_si256(eq_head, eq_tail)));
+            while (mask != 0) {
+                const std::size_t lane = first_lane<CharT>(mask);
+                if (std::memcmp(first + i + lane + 1, needle + 1, mid_bytes) == 0) {
+                    return i + lane;
+                }
+                mask &= ~(lane_bits << (lane * sizeof(CharT)));
+            }
+        }
+    }
+#endif
+
+#if defined(ZUU_SIMD_SSE2)
+    if constexpr (is_lane_char<CharT>) {
+        constexpr std::size_t lanes = 16 / sizeof(CharT);
+        const __m128i head = splat128(needle[0]);
+        const __m128i tail = splat128(needle[last_off]);
+        for (; i + last_off + lanes <= count; i += lanes) {
+            const auto eq_head = cmpeq128<CharT>(load128(first + i), head);
+            const auto eq_tail = cmpeq128<CharT>(load128(first + i + last_off), tail);
+            auto mask = static_cast<std::uint32_t>(
+                _mm_movemask_epi8(_mm_and_si128(eq_head, eq_tail)));
+            while (mask != 0) {
+                const std::size_t lane = first_lane<CharT>(mask);
+                if (std::memcmp(first + i + lane + 1, needle + 1, mid_bytes) == 0) {
+                    return i + lane;
+                }
+                mask &= ~(lane_bits << (lane * sizeof(CharT)));
+            }
+        }
+    }
+#endif
+
+    for (; i + len <= count; ++i) {
+        if (first[i] == needle[0] && first[i + last_off] == needle[last_off] &&
+            std::memcmp(first + i + 1, needle + 1, mid_bytes) == 0) {
+            return i;
+        }
+    }
+    return count;
+}
+
+// ==================== Mismatch ====================
+
+/**
+ * @brief Index of the first unit where [a, a + count) and [b, b + count) differ, or `count`
+ */
+template <meta::character CharT>
+inline std::size_t mismatch(const CharT* a, const CharT* b, std::size_t count) noexcept {
+    std::size_t i = 0;
+
+#if defined(ZUU_SIMD_AVX2)
+    if constexpr (is_lane_char<CharT>) {
+        constexpr std::size_t lanes = 32 / sizeof(CharT);
+        for (; i + lanes <= count; i += lanes) {
+            const auto eq = cmpeq256<CharT>(load256(a + i), load256(b + i));
+            const auto mask = ~static_cast<std::uint32_t>(_mm256_movemask_epi8(eq));
+            if (mask != 0) return i + first_lane<CharT>(mask);
+        }
+    }
+#endif
+
+#if defined(ZUU_SIMD_SSE2)
+    if constexpr (is_lane_char<CharT>) {
+        constexpr std::size_t lanes = 16 / sizeof(CharT);
+        for (; i + lanes <= count; i += lanes) {
+            const auto eq = cmpeq128<CharT>(load128(a + i), load128(b + i));
+            const auto mask = ~static_cast<std::uint32_t>(_mm_movemask_epi8(eq)) & 0xFFFFu;
+            if (mask != 0) return i + first_lane<CharT>(mask);
+        }
+    }
+#endif
+
+    for (; i < count; ++i) {
+        if (a[i] != b[i]) return i;
+    }
+    return count;
+}
+
+// ==================== ASCII Case ====================
+
+enum class ascii_case { lower, upper, toggle };
+
+/**
+ * @brief Letter test shared by the scalar and vector paths
+ *
+ * lower flips 'A'-'Z', upper flips 'a'-'z', toggle flips both: each is
+ * one unsigned range test of (ch | fold) - first, and the conversion is
+ * ch ^ 0x20 on the lanes that pass.
+ */
+template <ascii_case Op>
+struct ascii_case_range {
+    static constexpr unsigned first = Op == ascii_case::lower ? 'A' : 'a';
+    static constexpr unsigned fold = Op == ascii_case::toggle ? 0x20u : 0u;
+};
+
+template <ascii_case Op, meta::character CharT>
+constexpr CharT ascii_case_unit(CharT ch) noexcept {
+    using range = ascii_case_range<Op>;
+    const unsigned letter = static_cast<unsigned>(ch | CharT(range::fold)) - range::first < 26u;
+    return static_cast<CharT>(ch ^ CharT(letter << 5));
+}
+
+#if defined(ZUU_SIMD_SSE2)
+
+// Lanes of `v` converted by Op. The unsigned range test becomes one
+// signed compare once both sides are biased by the sign bit
+template <ascii_case Op, meta::character CharT>
+inline __m128i ascii_convert128(__m128i v) noexcept {
+    using range = ascii_case_range<Op>;
+    using U = std::make_unsigned_t<CharT>;
+    constexpr U sign = U(U(1) << (sizeof(CharT) * 8 - 1));
+    const __m128i bias = splat128(static_cast<CharT>(sign));
+    const __m128i folded = _mm_or_si128(v, splat128(static_cast<CharT>(range::fold)));
+    const __m128i off = _mm_xor_si128(sub128<CharT>(folded, splat128(static_cast<CharT>(range::first))), bias);
+    const __m128i letters = cmpgt128<CharT>(splat128(static_cast<CharT>(sign | 26u)), off);
+    return _mm_xor_si128(v, _mm_and_si128(letters, splat128(CharT(0x20))));
+}
+
+// Up to one vector of units through a zeroed staging buffer
+template <meta::character CharT>
+inline __m128i load_partial128(const CharT* p, std::size_t count) noexcept {
+    alignas(16) CharT buf[16 / sizeof(CharT)] = {};
+    std::memcpy(buf, p, count * sizeof(CharT));
+    return load128(buf);
+}
+
+#endif // ZUU_SIMD_SSE2
+
+#if defined(ZUU_SIMD_AVX2)
+
+template <ascii_case Op, meta::character CharT>
+inline __m256i ascii_convert256(__m256i v) noexcept {
+    using range = ascii_case_range<Op>;
+    using U = std::make_unsigned_t<CharT>;
+    constexpr U sign = U(U(1) << (sizeof(CharT) * 8 - 1));
+    const __m256i bias = splat256(static_cast<CharT>(sign));
+    const __m256i folded = _mm256_or_si256(v, splat256(static_cast<CharT>(range::fold)));
+    const __m256i off = _mm256_xor_si256(sub256<CharT>(folded, splat256(static_cast<CharT>(range::first))), bias);
+    const __m256i letters = cmpgt256<CharT>(splat256(static_cast<CharT>(sign | 26u)), off);
+    return _mm256_xor_si256(v, _mm256_and_si256(letters, splat256(CharT(0x20))));
+}
+
+#endif // ZUU_SIMD_AVX2
+
+/**
+ * @brief Convert the ASCII letters of [src, src + count) into
+ *        [dst, dst + count); other units are copied unchanged
+ *
+ * 64 bytes per AVX2 iteration (two vectors), then 16-byte vectors; the
+ * remainder is staged through one more vector (scalar without SSE2).
+ * `dst` may equal `src` or lie before it: each block is loaded before
+ * anything at or after it is stored.
+ */
+template <ascii_case Op, meta::character CharT>
+inline void ascii_case_convert(const CharT* src, std::size_t count, CharT* dst) noexcept {
+    std::size_t i = 0;
+
+#if defined(ZUU_SIMD_AVX2)
+    if constexpr (is_lane_char<CharT>) {
+        constexpr std::size_t lanes = 32 / sizeof(CharT);
+        for (; i + 2 * lanes <= count; i += 2 * lanes) {
+            const __m256i a = load256(src + i);
+            const __m256i b = load256(src + i + lanes);
+            store256(dst + i, ascii_convert256<Op, CharT>(a));
+            store256(dst + i + lanes, ascii_convert256<Op, CharT>(b));
+        }
+    }
+#endif
+
+#if defined(ZUU_SIMD_SSE2)
+    if constexpr (is_lane_char<CharT>) {
+        constexpr std::size_t lanes = 16 / sizeof(CharT);
+        for (; i + lanes <= count; i += lanes) {
+            store128(dst + i, ascii_convert128<Op, CharT>(load128(src + i)));
+        }
+
+        // Short strings (header names, identifiers) are mostly tail: stage
+        // it through one vector rather than converting unit by unit
+        if (i < count) {
+            alignas(16) CharT tail[lanes];
+            store128(tail, ascii_convert128<Op, CharT>(load_partial128(src + i, count - i)));
+            std::memcpy(dst + i, tail, (count - i) * sizeof(CharT));
+            return;
+        }
+    }
+#endif
+
+    for (; i < count; ++i) dst[i] = ascii_case_unit<Op>(src[i]);
+}
+
+#if defined(ZUU_SIMD_SSE2)
+
+// Movemask bits of the lanes outside U+0000-U+007F: bytes test their sign
+// bit directly, wider units test `unit & ~0x7F` against zero
+template <meta::character CharT>
+inline std::uint32_t non_ascii_mask128(__m128i v) noexcept {
+    if constexpr (sizeof(CharT) == 1) {
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(v));
+    } else {
+        const __m128i high = _mm_and_si128(v, splat128(static_cast<CharT>(~0x7Fu)));
+        return ~static_cast<std::uint32_t>(_mm_movemask_epi8(cmpeq128<CharT>(high, _mm_setzero_si128()))) & 0xFFFFu;
+    }
+}
+
+#endif // ZUU_SIMD_SSE2
+
+#if defined(ZUU_SIMD_AVX2)
+
+template <meta::character CharT>
+inline std::uint32_t non_ascii_mask256(__m256i v) noexcept {
+    if constexpr (sizeof(CharT) == 1) {
+        return static_cast<std::uint32_t>(_mm256_movemask_epi8(v));
+    } else {
+        const __m256i high = _mm256_and_si256(v, splat256(static_cast<CharT>(~0x7Fu)));
+        return ~static_cast<std::uint32_t>(_mm256_movemask_epi8(cmpeq256<CharT>(high, _mm256_setzero_si256())));
+    }
+}
+
+#endif // ZUU_SIMD_AVX2
+
+/**
+ * @brief Index of the first unit of [first, first + count) outside
+ *        U+0000-U+007F, or `count`
+ */
+template <meta::character CharT>
+inline std::size_t find_non_ascii(const CharT* first, std::size_t count) noexcept {
+    std::size_t i = 0;
+
+#if defined(ZUU_SIMD_AVX2)
+    if constexpr (is_lane_char<CharT>) {
+        constexpr std::size_t lanes = 32 / sizeof(CharT);
+        for (; i + lanes <= count; i += lanes) {
+            const std::uint32_t mask = non_ascii_mask256<CharT>(load256(first + i));
+            if (mask != 0) return i + first_lane<CharT>(mask);
+        }
+    }
+#endif
+
+#if defined(ZUU_SIMD_SSE2)
+    if constexpr (is_lane_char<CharT>) {
+        constexpr std::size_t lanes = 16 / sizeof(CharT);
+        for (; i + lanes <= count; i += lanes) {
+            const std::uint32_t mask = non_ascii_mask128<CharT>(load128(first + i));
+            if (mask != 0) return i + first_lane<CharT>(mask);
+        }
+    }
+#endif
+
+    using U = std::make_unsigned_t<CharT>;
+    for (; i < count; ++i) {
+        if (static_cast<U>(first[i]) > 0x7Fu) return i;
+    }
+    return count;
+}
+
+/**
+ * @brief Convert the ASCII units leading [src, src + count) into `dst`
+ *        a vector at a time; returns how many there are
+ *
+ * Each step stores a whole converted vector and advances by its leading
+ * ASCII lanes, so mixed text still moves a vector's worth of ASCII per
+ * step: [dst, dst + count) is scratch past the returned length, holding
+ * copies the caller overwrites as it continues. Only whole vectors are
+ * read, so this returns 0 below 16 bytes (and without SSE2).
+ */
+template <ascii_case Op, meta::character CharT>
+inline std::size_t ascii_case_prefix(
+    [[maybe_unused]] const CharT* src, [[maybe_unused]] std::size_t count, [[maybe_unused]] CharT* dst
+) noexcept {
+    std::size_t i = 0;
+
+#if defined(ZUU_SIMD_AVX2)
+    if constexpr (is_lane_char<CharT>) {
+        constexpr std::size_t lanes = 32 / sizeof(CharT);
+        for (; i + lanes <= count; i += lanes) {
+            const __m256i v = load256(src + i);
+            store256(dst + i, ascii_convert256<Op, CharT>(v));
+            const std::uint32_t mask = non_ascii_mask256<CharT>(v);
+            if (mask != 0) return i + first_lane<CharT>(mask);
+        }
+    }
+#endif
+
+#if defined(ZUU_SIMD_SSE2)
+    if constexpr (is_lane_char<CharT>) {
+        constexpr std::size_t lanes = 16 / sizeof(CharT);
+        for (; i + lanes <= count; i += lanes) {
+            const __m128i v = load128(src + i);
+            store128(dst + i, ascii_convert128<Op, CharT>(v));
+            const std::uint32_t mask = non_ascii_mask128<CharT>(v);
+            if (mask != 0) return i + first_lane<CharT>(mask);
+        }
+    }
+#endif
+
+    return i;
+}
+
+/**
+ * @brief Index of the first unit where [a, a + count) and [b, b + count)
+ *        differ after ASCII lowercasing, or `count`
+ */
+template <meta::character CharT>
+inline std::size_t mismatch_ignore_case(const CharT* a, const CharT* b, std::size_t count) noexcept {
+    constexpr auto lower = ascii_case::lower;
+    std::size_t i = 0;
+
+#if defined(ZUU_SIMD_AVX2)
+    if constexpr (is_lane_char<CharT>) {
+        constexpr std::size_t lanes = 32 / sizeof(CharT);
+        for (; i + lanes <= count; i += lanes) {
+            const __m256i la = ascii_convert256<lower, CharT>(load256(a + i));
+            const __m256i lb = ascii_convert256<lower, CharT>(load256(b + i));
+            const auto mask = ~static_cast<std::uint32_t>(_mm256_movemask_epi8(cmpeq256<CharT>(la, lb)));
+            if (mask != 0) return i + first_lane<CharT>(mask);
+        }
+    }
+#endif
+
+#if defined(ZUU_SIMD_SSE2)
+    if constexpr (is_lane_char<CharT>) {
+        constexpr std::size_t lanes = 16 / sizeof(CharT);
+        const auto differ = [](__m128i va, __m128i vb) {
+            const __m128i eq = cmpeq128<CharT>(ascii_convert128<lower, CharT>(va), ascii_convert128<lower, CharT>(vb));
+            return ~static_cast<std::uint32_t>(_mm_movemask_epi8(eq)) & 0xFFFFu;
+        };
+        for (; i + lanes <= count; i += lanes) {
+            const auto mask = differ(load128(a + i), load128(b + i));
+            if (mask != 0) return i + first_lane<CharT>(mask);
+        }
+        if (i < count) {
+            // Zeroed lanes past the end compare equal
+            const auto mask = differ(load_partial128(a + i, count - i), load_partial128(b + i, count - i));
+            return mask != 0 ? i + first_lane<CharT>(mask) : count;
+        }
+    }
+#endif
+
+    for (; i < count; ++i) {
+        if (ascii_case_unit<lower>(a[i]) != ascii_case_unit<lower>(b[i])) return i;
+    }
+    return count;
+}
+
+/**
+ * @brief Index of the first unit of [first, first + count) equal to `ch`
+ *        after ASCII lowercasing both, or `count`
+ */
+template <meta::character CharT>
+inline std::size_t find_char_ignore_case(const CharT* first, std::size_t count, CharT ch) noexcept {
+    constexpr auto lower = ascii_case::lower;
+    ch = ascii_case_unit<lower>(ch);
+    std::size_t i = 0;
+
+#if defined(ZUU_SIMD_AVX2)
+    if constexpr (is_lane_char<CharT>) {
+        constexpr std::size_t lanes = 32 / sizeof(CharT);
+        const __m256i needle = splat256(ch);
+        for (; i + lanes <= count; i += lanes) {
+            const auto eq = cmpeq256<CharT>(ascii_convert256<lower, CharT>(load256(first + i)), needle);
+            const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(eq));
+            if (mask != 0) return i + first_lane<CharT>(mask);
+        }
+    }
+#endif
+
+#if defined(ZUU_SIMD_SSE2)
+    if constexpr (is_lane_char<CharT>) {
+        constexpr std::size_t lanes = 16 / sizeof(CharT);
+        const __m128i needle = splat128(ch);
+        for (; i + lanes <= count; i += lanes) {
+            const auto eq = cmpeq128<CharT>(ascii_convert128<lower, CharT>(load128(first + i)), needle);
+            const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(eq));
+            if (mask != 0) return i + first_lane<CharT>(mask);
+        }
+    }
+#endif
+
+    for (; i < count; ++i) {
+        if (ascii_case_unit<lower>(first[i]) == ch) return i;
+    }
+    return count;
+}
+
+/**
+ * @brief Index of `needle` in [first, first + count) ignoring ASCII case,
+ *        or `count`
+ *
+ * find_substr's first/last unit filter over lowercased vectors; the
+ * middle is verified with mismatch_ignore_case. Requires
+ * 2 <= len <= count.
+ */
+template <meta::character CharT>
+inline std::size_t find_substr_ignore_case(
+    const CharT* first, std::size_t count,
+    const CharT* needle, std::size_t len
+) noexcept {
+    constexpr auto lower = ascii_case::lower;
+    std::size_t i = 0;
+    const std::size_t last_off = len - 1;
+    const CharT head_unit = ascii_case_unit<lower>(needle[0]);
+    const CharT tail_unit = ascii_case_unit<lower>(needle[last_off]);
+
+    const auto middle_matches = [&](std::size_t at) {
+        return mismatch_ignore_case(first + at + 1, needle + 1, len - 2) == len - 2;
+    };
+
+    [[maybe_unused]] constexpr std::uint32_t lane_bits = (1u << sizeof(CharT)) - 1;
+
+#if defined(ZUU_SIMD_AVX2)
+    if constexpr (is_lane_char<CharT>) {
+        constexpr std::size_t lanes = 32 / sizeof(CharT);
+        const __m256i head = splat256(head_unit);
+        const __m256i tail = splat256(tail_unit);
+        for (; i + last_off + lanes <= count; i += lanes) {
+            const auto eq_head = cmpeq256<CharT>(ascii_convert256<lower, CharT>(load256(first + i)), head);
+            const auto eq_tail = cmpeq256<CharT>(ascii_convert256<lower, CharT>(load256(first + i + last_off)), tail);
+            auto mask = static_cast<std::uint32_t>(
+                _mm256_movemask_epi8(_mm256_and_si256(eq_head, eq_tail)));
+            while (mask != 0) {
+                const std::size_t lane = first_lane<CharT>(mask);
+                if (middle_matches(i + lane)) return i + lane;
+                mask &= ~(lane_bits << (lane * sizeof(CharT)));
+            }
+        }
+    }
+#endif
+
+#if defined(ZUU_SIMD_SSE2)
+    if constexpr (is_lane_char<CharT>) {
+        constexpr std::size_t lanes = 16 / sizeof(CharT);
+        const __m128i head = splat128(head_unit);
+        const __m128i tail = splat128(tail_unit);
+        for (; i + last_off + lanes <= count; i += lanes) {
+            const auto eq_head = cmpeq128<CharT>(ascii_convert128<lower, CharT>(load128(first + i)), head);
+            const auto eq_tail = cmpeq128<CharT>(ascii_convert128<lower, CharT>(load128(first + i + last_off)), tail);
+            auto mask = static_cast<std::uint32_t>(
+                _mm_movemask_epi8(_mm_and_si128(eq_head, eq_tail)));
+            while (mask != 0) {
+                const std::size_t lane = first_lane<CharT>(mask);
+                if (middle_matches(i + lane)) return i + lane;
+                mask &= ~(lane_bits << (lane * sizeof(CharT)));
+            }
+        }
+    }
+#endif
+
+    for (; i + len <= count; ++i) {
+        if (ascii_case_unit<lower>(first[i]) == head_unit &&
+            ascii_case_unit<lower>(first[i + last_off]) == tail_unit && middle_matches(i)) {
+            return i;
+        }
+    }
+    return count;
+}
+
+// ==================== Byte Class Scan ====================
+
+/**
+ * @brief Membership of byte `b` in a nibble-split class table
+ *
+ * `low` covers bytes 0x00-0x7F and `high` covers 0x80-0xFF: entry
+ * [b & 0xF] holds bit ((b >> 4) & 7) when b is a member. This is the
+ * layout a single byte shuffle can index, 16 bytes at a time.
+ */
+inline constexpr bool class_member(
+    unsigned char b, const std::uint8_t* low, const std::uint8_t* high
+) noexcept {
+    const std::uint8_t row = (b & 0x80) ? high[b & 0x0F] : low[b & 0x0F];
+    return (row >> ((b >> 4) & 7)) & 1;
+}
+
+#if defined(ZUU_SIMD_SSE2)
+
+inline __m128i load_table(const std::uint8_t* table) noexcept {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(table));
+}
+
+#endif
+
+#if defined(ZUU_SIMD_SSSE3)
+
+// Bit per byte set for members; pshufb zeroes lanes whose index has bit 7 set
+inline std::uint32_t class_mask128(__m128i v, __m128i low, __m128i high) noexcept {
+    const __m128i bit_of = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+                                         1, 2, 4, 8, 16, 32, 64, -128);
+    const __m128i rows = _mm_or_si128(
+        _mm_shuffle_epi8(low, v),
+        _mm_shuffle_epi8(high, _mm_xor_si128(v, _mm_set1_epi8(static_cast<char>(0x80)))));
+    const __m128i nib = _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0F));
+    const __m128i hit = _mm_and_si128(rows, _mm_shuffle_epi8(bit_of, nib));
+    return ~static_cast<std::uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(hit, _mm_setzero_si128()))) & 0xFFFFu;
+}
+
+#endif // ZUU_SIMD_SSSE3
+
+#if defined(ZUU_SIMD_AVX2)
+
+inline std::uint32_t class_mask256(__m256i v, __m256i low, __m256i high) noexcept {
+    const __m256i bit_of = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+                                            1, 2, 4, 8, 16, 32, 64, -128,
+                                            1, 2, 4, 8, 16, 32, 64, -128,
+                                            1, 2, 4, 8, 16, 32, 64, -128);
+    const __m256i rows = _mm256_or_si256(
+        _mm256_shuffle_epi8(low, v),
+        _mm256_shuffle_epi8(high, _mm256_xor_si256(v, _mm256_set1_epi8(static_cast<char>(0x80)))));
+    const __m256i nib = _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0F));
+    const __m256i hit = _mm256_and_si256(rows, _mm256_shuffle_epi8(bit_of, nib));
+    return ~static_cast<std::uint32_t>(
+        _mm256_movemask_epi8(_mm256_cmpeq_epi8(hit, _mm256_setzero_si256())));
+}
+
+#endif // ZUU_SIMD_AVX2
+
+/**
+ * @brief Index of the first byte whose membership equals `Member`, or `count`
+ */
+template <bool Member, meta::character CharT>
+requires (sizeof(CharT) == 1)
+inline std::size_t find_class(
+    const CharT* first, std::size_t count,
+    const std::uint8_t* low, const std::uint8_t* high
+) noexcept {
+    std::size_t i = 0;
+
+#if defined(ZUU_SIMD_AVX2)
+    {
+        const __m256i lo = _mm256_broadcastsi128_si256(load_table(low));
+        const __m256i hi = _mm256_broadcastsi128_si256(load_table(high));
+        for (; i + 32 <= count; i += 32) {
+            std::uint32_t mask = class_mask256(load256(first + i), lo, hi);
+            if constexpr (!Member) mask = ~mask;
+            if (mask != 0) return i + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+#endif
+
+#if defined(ZUU_SIMD_SSSE3)
+    {
+        const __m128i lo = load_table(low);
+        const __m128i hi = load_table(high);
+        for (; i + 16 <= count; i += 16) {
+            std::uint32_t mask = class_mask128(load128(first + i), lo, hi);
+            if constexpr (!Member) mask = ~mask & 0xFFFFu;
+            if (mask != 0) return i + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+#endif
+
+    for (; i < count; ++i) {
+        if (class_member(static_cast<unsigned char>(first[i]), low, high) == Member) return i;
+    }
+    return count;
+}
+
+/**
+ * @brief Index of the last byte whose membership equals `Member`, or `count`
+ */
+template <bool Member, meta::character CharT>
+requires (sizeof(CharT) == 1)
+inline std::size_t rfind_class(
+    const CharT* first, std::size_t count,
+    const std::uint8_t* low, const std::uint8_t* high
+) noexcept {
+    std::size_t i = count;
+
+#if defined(ZUU_SIMD_AVX2)
+    {
+        const __m256i lo = _mm256_broadcastsi128_si256(load_table(low));
+        const __m256i hi = _mm256_broadcastsi128_si256(load_table(high));
+        for (; i >= 32; i -= 32) {
+            std::uint32_t mask = class_mask256(load256(first + i - 32), lo, hi);
+            if constexpr (!Member) mask = ~mask;
+            if (mask != 0) return i - 32 + last_lane<CharT>(mask);
+        }
+    }
+#endif
+
+#if defined(ZUU_SIMD_SSSE3)
+    {
+        const __m128i lo = load_table(low);
+        const __m128i hi = load_table(high);
+        for (; i >= 16; i -= 16) {
+            std::uint32_t mask = class_mask128(load128(first + i - 16), lo, hi);
+            if constexpr (!Member) mask = ~mask & 0xFFFFu;
+            if (mask != 0) return i - 16 + last_lane<CharT>(mask);
+        }
+    }
+#endif
+
+    for (; i > 0; --i) {
+        if (class_member(static_cast<unsigned char>(first[i - 1]), low, high) == Member) return i - 1;
+    }
+    return count;
+}
+
+// ==================== ASCII Whitespace ====================
+
+/*
+ * The six units trim treats as space: ' ' and '\t' through '\r'. A lane
+ * is tested with one equality and one signed range check, 8 < v < 14;
+ * units with the top bit set compare negative and stay outside it, so the
+ * same three compares serve every lane width.
+ */
+
+template <meta::character CharT>
+constexpr bool ascii_space_unit(CharT ch) noexcept {
+    using U = std::make_unsigned_t<CharT>;
+    const auto u = static_cast<U>(ch);
+    return u == U(' ') || (u >= U('\t') && u <= U('\r'));
+}
+
+#if defined(ZUU_SIMD_SSE2)
+
+template <meta::character CharT>
+inline std::uint32_t space_mask128(__m128i v) noexcept {
+    const __m128i space = cmpeq128<CharT>(v, splat128(static_cast<CharT>(' ')));
+    const __m128i control = _mm_and_si128(
+        cmpgt128<CharT>(v, splat128(static_cast<CharT>('\t' - 1))),
+        cmpgt128<CharT>(splat128(static_cast<CharT>('\r' + 1)), v));
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_or_si128(space, control)));
+}
+
+#endif // ZUU_SIMD_SSE2
+
+#if defined(ZUU_SIMD_AVX2)
+
+template <meta::character CharT>
+inline std::uint32_t space_mask256(__m256i v) noexcept {
+    const __m256i space = cmpeq256<CharT>(v, splat256(static_cast<CharT>(' ')));
+    const __m256i control = _mm256_and_si256(
+        cmpgt256<CharT>(v, splat256(static_cast<CharT>('\t' - 1))),
+        cmpgt256<CharT>(splat256(static_cast<CharT>('\r' + 1)), v));
+    return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(space, control)));
+}
+
+#endif // ZUU_SIMD_AVX2
+
+/**
+ * @brief Index of the first non-space unit in [first, first + count), or `count`
+ */
+template <meta::character CharT>
+inline std::size_t find_not_space(const CharT* first, std::size_t count) noexcept {
+    std::size_t i = 0;
+
+#if defined(ZUU_SIMD_AVX2)
+    if constexpr (is_lane_char<CharT>) {
+        constexpr std::size_t lanes = 32 / sizeof(CharT);
+        for (; i + lanes <= count; i += lanes) {
+            const std::uint32_t mask = ~space_mask256<CharT>(load256(first + i));
+            if (mask != 0) return i + first_lane<CharT>(mask);
+        }
+    }
+#endif
+
+#if defined(ZUU_SIMD_SSE2)
+    if constexpr (is_lane_char<CharT>) {
+        constexpr std::size_t lanes = 16 / sizeof(CharT);
+        for (; i + lanes <= count; i += lanes) {
+            const std::uint32_t mask = ~space_mask128<CharT>(load128(first + i)) & 0xFFFFu;
+            if (mask != 0) return i + first_lane<CharT>(mask);
+        }
+    }
+#endif
+
+    for (; i < count; ++i) {
+        if (!ascii_space_unit(first[i])) return i;
+    }
+    return count;
+}
+
+/**
+ * @brief Index of the last non-space unit in [first, first + count), or `count`
+ */
+template <meta::character CharT>
+inline std::size_t rfind_not_space(const CharT* first, std::size_t count) noexcept {
+    std::size_t i = count;
+
+#if defined(ZUU_SIMD_AVX2)
+    if constexpr (is_lane_char<CharT>) {
+        constexpr std::size_t lanes = 32 / sizeof(CharT);
+        for (; i >= lanes; i -= lanes) {
+            const std::uint32_t mask = ~space_mask256<CharT>(load256(first + i - lanes));
+            if (mask != 0) return i - lanes + last_lane<CharT>(mask);
+        }
+    }
+#endif
+
+#if defined(ZUU_SIMD_SSE2)
+    if constexpr (is_lane_char<CharT>) {
+        constexpr std::size_t lanes = 16 / sizeof(CharT);
+        for (; i >= lanes; i -= lanes) {
+            const std::uint32_t mask = ~space_mask128<CharT>(load128(first + i - lanes)) & 0xFFFFu;
+            if (mask != 0) return i - lanes + last_lane<CharT>(mask);
+        }
+    }
+#endif
+
+    for (; i > 0; --i) {
+        if (!ascii_space_unit(first[i - 1])) return i - 1;
+    }
+    return count;
+}
+
+// ==================== Delimiter Bitmasks ====================
+
+/*
+ * A delimiter matcher classifies a whole vector at once (`match`, one
+ * 0xFF byte per delimiter) and a single unit (`test`). block_mask64 turns
+ * 64 bytes into a 64-bit delimiter bitmask, the simdjson/simdcsv layout,
+ * and for_each_token walks its set bits to emit token boundaries.
+ * Byte-sized code units only; wider units take the scalar path.
+ */
+
+template <meta::character CharT>
+struct unit_matcher {
+    CharT ch;
+
+    constexpr bool test(CharT c) const noexcept { return c == ch; }
+
+#if defined(ZUU_SIMD_SSE2)
+    __m128i match(__m128i v) const noexcept { return _mm_cmpeq_epi8(v, splat128(ch)); }
+#endif
+#if defined(ZUU_SIMD_AVX2)
+    __m256i match(__m256i v) const noexcept { return _mm256_cmpeq_epi8(v, splat256(ch)); }
+#endif
+};
+
+// Either of two units, e.g. a field delimiter and '\n'
+template <meta::character CharT>
+struct pair_matcher {
+    CharT a;
+    CharT b;
+
+    constexpr bool test(CharT c) const noexcept { return c == a || c == b; }
+
+#if defined(ZUU_SIMD_SSE2)
+    __m128i match(__m128i v) const noexcept {
+        return _mm_or_si128(_mm_cmpeq_epi8(v, splat128(a)), _mm_cmpeq_epi8(v, splat128(b)));
+    }
+#endif
+#if defined(ZUU_SIMD_AVX2)
+    __m256i match(__m256i v) const noexcept {
+        return _mm256_or_si256(_mm256_cmpeq_epi8(v, splat256(a)), _mm256_cmpeq_epi8(v, splat256(b)));
+    }
+#endif
+};
+
+// '\n' and '\r': with empty tokens skipped, "\r\n" is a single boundary
+template <meta::character CharT>
+struct line_matcher {
+    constexpr bool test(CharT c) const noexcept { return c == CharT('\n') || c == CharT('\r'); }
+
+#if defined(ZUU_SIMD_SSE2)
+    __m128i match(__m128i v) const noexcept {
+        return _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')),
+                            _mm_cmpeq_epi8(v, _mm_set1_epi8('\r')));
+    }
+#endif
+#if defined(ZUU_SIMD_AVX2)
+    __m256i match(__m256i v) const noexcept {
+        return _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')),
+                               _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\r')));
+    }
+#endif
+};
+
+// ' ' and '\t' '\n' '\v' '\f' '\r' (0x09-0x0D, one unsigned range check)
+template <meta::character CharT>
+struct space_matcher {
+    constexpr bool test(CharT c) const noexcept {
+        return c == CharT(' ') || (c >= CharT('\t') && c <= CharT('\r'));
+    }
+
+#if defined(ZUU_SIMD_SSE2)
+    __m128i match(__m128i v) const noexcept {
+        const __m128i d = _mm_sub_epi8(v, _mm_set1_epi8('\t'));
+        return _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')),
+                            _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(4)), d));
+    }
+#endif
+#if defined(ZUU_SIMD_AVX2)
+    __m256i match(__m256i v) const noexcept {
+        const __m256i d = _mm256_sub_epi8(v, _mm256_set1_epi8('\t'));
+        return _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')),
+                               _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8(4)), d));
+    }
+#endif
+};
+
+#if defined(ZUU_SIMD_SSE2)
+
+/**
+ * @brief Bit i set when first[i] is a delimiter, for i in [0, 64)
+ */
+template <typename Matcher, meta::character CharT>
+requires (sizeof(CharT) == 1)
+inline std::uint64_t block_mask64(const Matcher& m, const CharT* first) noexcept {
+#if defined(ZUU_SIMD_AVX2)
+    const auto lo = static_cast<std::uint32_t>(_mm256_movemask_epi8(m.match(load256(first))));
+    const auto hi = static_cast<std::uint32_t>(_mm256_movemask_epi8(m.match(load256(first + 32))));
+    return std::uint64_t{lo} | (std::uint64_t{hi} << 32);
+#else
+    std::uint64_t mask = 0;
+    for (int k = 0; k < 4; ++k) {
+        const auto bits = static_cast<std::uint16_t>(_mm_movemask_epi8(m.match(load128(first + 16 * k))));
+        mask |= std::uint64_t{bits} << (16 * k);
+    }
+    return mask;
+#endif
+}
+
+#endif // ZUU_SIMD_SSE2
+
+/**
+ * @brief Calls `emit(first, last)` for every non-empty token; stops early
+ *        when `emit` returns false
+ *
+ * Offsets are relative to `first`. Tokens are runs of non-delimiters, so
+ * consecutive delimiters produce no empty tokens.
+ */
+template <typename Matcher, meta::character CharT, typename Emit>
+inline void for_each_token(const CharT* first, std::size_t count, const Matcher& m, Emit&& emit) {
+    std::size_t start = 0;
+    std::size_t i = 0;
+
+#if defined(ZUU_SIMD_SSE2)
+    if constexpr (sizeof(CharT) == 1) {
+        for (; i + 64 <= count; i += 64) {
+            for (std::uint64_t mask = block_mask64(m, first + i); mask != 0; mask &= mask - 1) {
+                const std::size_t pos = i + static_cast<std::size_t>(std::countr_zero(mask));
+                if (pos > start && !emit(start, pos)) return;
+                start = pos + 1;
+            }
+        }
+    }
+#endif
+
+    for (; i < count; ++i) {
+        if (m.test(first[i])) {
+            if (i > start && !emit(start, i)) return;
+            start = i + 1;
+        }
+    }
+    if (count > start) emit(start, count);
+}
+
+/**
+ * @brief Bit i of the result is the XOR of bits [0, i] of `x`
+ *
+ * Applied to a quote bitmask this marks the bytes inside quotes (opening
+ * quote included, closing quote excluded), the simdjson/simdcsv trick.
+ * Carry-less multiply by all-ones where PCLMUL is available.
+ */
+inline std::uint64_t prefix_xor(std::uint64_t x) noexcept {
+#if defined(__PCLMUL__)
+    const __m128i product = _mm_clmulepi64_si128(
+        _mm_set_epi64x(0, static_cast<long long>(x)), _mm_set1_epi8(-1), 0);
+    return static_cast<std::uint64_t>(_mm_cvtsi128_si64(product));
+#else
+    x ^= x << 1;
+    x ^= x << 2;
+    x ^= x << 4;
+    x ^= x << 8;
+    x ^= x << 16;
+    x ^= x << 32;
+    return x;
+#endif
+}
+
+// ==================== Decimal Digits ====================
+
+#if defined(ZUU_SIMD_AVX2)
+
+// Row n moves the first n bytes of a register to its end; index bytes
+// with bit 7 set make pshufb write zeros in front
+inline constexpr auto right_align_masks = [] {
+    struct rows {
+        alignas(16) std::uint8_t row[17][16];
+    } masks{};
+    for (unsigned n = 0; n <= 16; ++n) {
+        for (unsigned i = 0; i < 16; ++i) {
+            masks.row[n][i] = static_cast<std::uint8_t>(i + n >= 16 ? i + n - 16 : 0x80);
+        }
+    }
+    return masks;
+}();
+
+/**
+ * @brief Count the leading decimal digits of p[0, 16) (at most 16) and
+ *        store their value in `value`
+ *
+ * The digits are shifted to the end of the register behind zeros, so any
+ * count from 0 to 16 takes the same instructions: pairs, quads and
+ * eights come from three multiply-adds (pmaddubsw, pmaddwd) and a pack,
+ * SSSE3 and SSE4.1 instructions every AVX2 target has.
+ *
+ * Precondition: p[0, 16) is readable, even when fewer digits follow.
+ * The only caller, detail::parsing::accumulate (fmt/parsing.hpp), calls
+ * it only while `last - p >= 16` and finishes shorter tails 8 or 1
+ * units at a time.
+ */
+template <meta::character CharT>
+requires (sizeof(CharT) == 1)
+inline unsigned read_digits16(const CharT* p, std::uint64_t& value) noexcept {
+    const __m128i nine = _mm_set1_epi8(9);
+    const __m128i v = _mm_sub_epi8(load128(p), _mm_set1_epi8('0'));
+    const auto digit = static_cast<std::uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(v, nine), nine)));
+    const auto n = static_cast<unsigned>(std::countr_one(digit));
+
+    const __m128i aligned = _mm_shuffle_epi8(
+        v, _mm_load_si128(reinterpret_cast<const __m128i*>(right_align_masks.row[n])));
+    const __m128i pairs = _mm_maddubs_epi16(aligned, _mm_setr_epi8(
+        10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1));
+    const __m128i quads = _mm_madd_epi16(pairs, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+    const __m128i packed = _mm_packus_epi32(quads, quads);
+    const __m128i eights = _mm_madd_epi16(packed, _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
+    value = std::uint64_t{static_cast<std::uint32_t>(_mm_cvtsi128_si32(eights))} * 100000000 +
+            static_cast<std::uint32_t>(_mm_extract_epi32(eights, 1));
+    return n;
+}
+
+#endif // ZUU_SIMD_AVX2
+
+} // namespace zuu::detail::simd
@@ -7,16 +7,25 @@
  * 
  * Usage:
  *   auto s = to_fstring(42);              // "42"
+ *   auto s = to_fstring(0.1);             // "0.1" (shortest round-trip)
+ *   auto s = to_fstring(scientific(1500.0, 2)); // "1.50e+03"
  *   auto s = to_fstring(hex(255));         // "0xff"
  *   auto s = to_fstring(bin(5));           // "0b101"
  *   auto s = to_fstring(pad_left(42, 5));  // "00042"
+ *   format_to(line, id);                   // appended in place
+ *   auto [end, ec] = from_chars(first, last, value); // strtod, correctly rounded
+ *   if (auto n = parse_int<int>(view)) use(n.value);  // n.count, n.ec
  */
 
 #include "../core/core.hpp"
 #include "../meta/concepts.hpp"
-#include <cmath>
+#include "digits.hpp"
+#include "floating.hpp"
+#include "parsing.hpp"
 #include <concepts>
 #include <limits>
+#include <string_view>
+#include <system_error>
 
 namespace zuu::fmt {
 
@@ -25,96 +34,111 @@ namespace zuu::fmt {
 template <typename T>
 struct formatter;
 
-// Default formatter for integrals
+// Default formatter for integrals: digits written in place, a pair at a
+// time, once the length is known (digits.hpp)
 template <std::integral T>
 struct formatter<T> {
+    static constexpr std::size_t max_digits = std::numeric_limits<T>::digits10 + 3;
+
     template <meta::character CharT = char>
     static constexpr auto format(T value) noexcept {
-        constexpr std::size_t max_digits = std::numeric_limits<T>::digits10 + 3;
         basic_fstring<CharT, max_digits> result;
-        
-        if (value == 0) {
-            result.push_back(CharT('0'));
-            return result;
+        const magnitude m{value};
+        result.resize_and_overwrite(max_digits, [&](CharT* buf, std::size_t) {
+            return m.write(buf, buf + max_digits);
+        });
+        return result;
+    }
+
+    // Writes straight into `out`; a value that does not fit is cut like
+    // any other append
+    template <meta::character CharT, std::size_t Cap>
+    static constexpr basic_fstring<CharT, Cap>& append(basic_fstring<CharT, Cap>& out, T value) noexcept {
+        const magnitude m{value};
+        const std::size_t start = out.size();
+        if (start + m.size() > Cap) {
+            const auto whole = format<CharT>(value);
+            return out.append(whole.data(), whole.size());
         }
         
+        out.resize_and_overwrite(Cap, [&](CharT* buf, std::size_t) {
+            return start + m.write(buf + start, buf + Cap);
+        });
+        return out;
+    }
+
+private:
+    using UIntT = std::make_unsigned_t<T>;
+
+    struct magnitude {
+        UIntT value;
         bool negative = false;
-        using UIntT = std::make_unsigned_t<T>;
-        UIntT uvalue;
-        
-        if constexpr (std::is_signed_v<T>) {
-            if (value < 0) {
-                negative = true;
-                uvalue = static_cast<UIntT>(-(value + 1)) + 1;
-            } else {
-                uvalue = static_cast<UIntT>(value);
+        unsigned len;
+
+        constexpr explicit magnitude(T v) noexcept : value{static_cast<UIntT>(v)} {
+            if constexpr (std::is_signed_v<T>) {
+                if (v < 0) {
+                    negative = true;
+                    value = static_cast<UIntT>(0u - value);
+                }
             }
-        } else {
-            uvalue = value;
-        }
-        
-        CharT buffer[max_digits];
-        std::size_t pos = 0;
-        
-        while (uvalue > 0) {
-            buffer[pos++] = CharT('0') + (uvalue % 10);
-            uvalue /= 10;
+            len = detail::digits::count(value);
         }
-        
-        if (negative) result.push_back(CharT('-'));
-        
-        while (pos > 0) {
-            result.push_back(buffer[--pos]);
+
+        constexpr std::size_t size() const noexcept { return len + negative; }
+
+        // [out, end) holds size() units; returns size()
+        template <meta::character CharT>
+        constexpr std::size_t write(CharT* out, CharT* end) const noexcept {
+            if (negative) *out++ = CharT('-');
+            // 8 units of room let the leading chunk skip its length branch
+            if (end - out >= 8) {
+                detail::digits::write(out, value, len);
+            } else {
+                detail::digits::write<true>(out, value, len);
+            }
+            return size();
         }
-        
-        return result;
-    }
+    };
 };
 
-// Default formatter for floating point
+// Default formatter for floating point: the shortest digits that read
+// back as the same value, in the shorter of fixed and scientific
+// notation (floating.hpp)
 template <std::floating_point T>
 struct formatter<T> {
+    static constexpr std::size_t max_shortest = std::numeric_limits<detail::floating::binary_t<T>>::max_digits10 + 7;
+    static constexpr std::size_t max_size = 64;
+
     template <meta::character CharT = char>
-    static constexpr auto format(T value, int precision = 6) noexcept {
-        constexpr std::size_t max_size = 64;
+    static constexpr auto format(T value) noexcept {
+        basic_fstring<CharT, max_shortest> result;
+        result.resize_and_overwrite(max_shortest, [&](CharT* buf, std::size_t) {
+            return static_cast<std::size_t>(detail::floating::write(buf, buf + max_shortest, value) - buf);
+        });
+        return result;
+    }
+
+    // Fixed notation, `precision` digits after the point, rounded half to
+    // even like printf; longer text is cut at max_size
+    template <meta::character CharT = char>
+    static constexpr auto format(T value, int precision) noexcept {
         basic_fstring<CharT, max_size> result;
-        
-        // Constexpr-friendly NaN/Inf check (avoid std::isnan in constexpr)
-        if (!std::is_constant_evaluated()) {
-            if (std::isnan(value)) {
-                result.append("nan", 3);
-                return result;
-            }
-            if (std::isinf(value)) {
-                if (value < 0) result.push_back(CharT('-'));
-                result.append("inf", 3);
-                return result;
-            }
-        }
-        
-        if (value < 0) {
-            result.push_back(CharT('-'));
-            value = -value;
-        }
-        
-        auto int_part = static_cast<long long>(value);
-        auto int_str = formatter<long long>::format(int_part);
-        result.append(int_str.data(), int_str.size());
-        
-        if (precision > 0) {
-            result.push_back(CharT('.'));
-            T frac = value - static_cast<T>(int_part);
-            
-            for (int i = 0; i < precision && !result.full(); ++i) {
-                frac *= 10;
-                int digit = static_cast<int>(frac);
-                result.push_back(CharT('0') + digit);
-                frac -= digit;
-            }
-        }
-        
+        result.resize_and_overwrite(max_size, [&](CharT* buf, std::size_t) {
+            return static_cast<std::size_t>(detail::floating::write(
+                buf, buf + max_size, value, detail::floating::notation::fixed, precision) - buf);
+        });
         return result;
     }
+
+    template <meta::character CharT, std::size_t Cap>
+    static constexpr basic_fstring<CharT, Cap>& append(basic_fstring<CharT, Cap>& out, T value) noexcept {
+        const std::size_t start = out.size();
+        out.resize_and_overwrite(Cap, [&](CharT* buf, std::size_t) {
+            return static_cast<std::size_t>(detail::floating::write(buf + start, buf + Cap, value) - buf);
+        });
+        return out;
+    }
 };
 
 // ==================== Hex Proxy ====================
@@ -207,6 +231,72 @@ struct formatter<bin_proxy<T>> {
     }
 };
 
+// ==================== Floating-Point Proxy ====================
+
+enum class float_style : unsigned char { fixed, scientific, general };
+
+// Without a precision the shortest round-trip digits are laid out in the
+// style; with one, the value is rounded to it (printf's %f, %e, %g)
+template <std::floating_point T>
+struct float_proxy {
+    T value;
+    float_style style;
+    int precision;
+
+    constexpr float_proxy(T v, float_style s, int p = -1)
+        : value{v}, style{s}, precision{p} {}
+};
+
+template <std::floating_point T>
+constexpr auto fixed(T value, int precision = -1) {
+    return float_proxy{value, float_style::fixed, precision};
+}
+
+template <std::floating_point T>
+constexpr auto scientific(T value, int precision = -1) {
+    return float_proxy{value, float_style::scientific, precision};
+}
+
+template <std::floating_point T>
+constexpr auto general(T value, int precision = -1) {
+    return float_proxy{value, float_style::general, precision};
+}
+
+template <std::floating_point T>
+struct formatter<float_proxy<T>> {
+    static constexpr std::size_t max_size = 64;
+
+    // Longer text (fixed notation of large values, long precisions) is
+    // cut at max_size; format_to into a larger string keeps all of it
+    template <meta::character CharT = char>
+    static constexpr auto format(const float_proxy<T>& proxy) noexcept {
+        basic_fstring<CharT, max_size> result;
+        result.resize_and_overwrite(max_size, [&](CharT* buf, std::size_t) {
+            return static_cast<std::size_t>(write(buf, buf + max_size, proxy) - buf);
+        });
+        return result;
+    }
+
+    template <meta::character CharT, std::size_t Cap>
+    static constexpr basic_fstring<CharT, Cap>& append(basic_fstring<CharT, Cap>& out, const float_proxy<T>& proxy) noexcept {
+        const std::size_t start = out.size();
+        out.resize_and_overwrite(Cap, [&](CharT* buf, std::size_t) {
+            return static_cast<std::size_t>(write(buf + start, buf + Cap, proxy) - buf);
+        });
+        return out;
+    }
+
+private:
+    template <meta::character CharT>
+    static constexpr CharT* write(CharT* first, CharT* last, const float_proxy<T>& proxy) noexcept {
+        using detail::floating::notation;
+        const notation how = proxy.style == float_style::fixed ? notation::fixed
+                           : proxy.style == float_style::scientific ? notation::scientific
+                           : notation::general;
+        return detail::floating::write(first, last, proxy.value, how, proxy.precision);
+    }
+};
+
 // ==================== Padding Proxy ====================
 
 template <std::integral T>
@@ -271,75 +361,112 @@ constexpr auto to_fstring(T value, int precision) noexcept {
     return formatter<T>::format(value, precision);
 }
 
+/**
+ * @brief Append the formatted `value` to `out` without a temporary when
+ *        the formatter writes in place (formatter<T>::append)
+ */
+template <meta::character CharT, std::size_t Cap, typename T>
+constexpr basic_fstring<CharT, Cap>& format_to(basic_fstring<CharT, Cap>& out, const T& value) noexcept {
+    using F = formatter<std::decay_t<T>>;
+    if constexpr (requires { F::append(out, value); }) {
+        return F::append(out, value);
+    } else {
+        const auto text = F::template format<CharT>(value);
+        return out.append(text.data(), text.size());
+    }
+}
+
 // ==================== Parsing ====================
 
+template <meta::character CharT>
+struct from_chars_result {
+    const CharT* ptr;
+    std::errc ec;
+
+    constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
+};
+
+/**
+ * @brief Read a floating-point number from [first, last), as
+ *        std::from_chars does, correctly rounded (parsing.hpp)
+ *
+ * Accepts [+|-] digits [. digits] [e|E [+|-] digits], "inf", "infinity"
+ * and "nan" in any case. Unlike std::from_chars, a leading '+' is
+ * accepted, as parse_float always has. `ptr` is the end of the match.
+ * Without a match, `ptr` is `first` and `ec` invalid_argument; a value
+ * that rounds to zero from nonzero digits or past the largest finite one
+ * gives result_out_of_range. `value` is written only on success.
+ */
+template <std::floating_point T, meta::character CharT>
+constexpr from_chars_result<CharT> from_chars(const CharT* first, const CharT* last, T& value) noexcept {
+    T result{};
+    std::errc ec{};
+    const CharT* end = detail::parsing::read(first, last, result, ec);
+    if (ec == std::errc{}) value = result;
+    return {end, ec};
+}
+
+/**
+ * @brief Read an integer in `base` (2 to 36) from [first, last), as
+ *        std::from_chars does, with overflow reported (parsing.hpp)
+ *
+ * Accepts [+|-] digits, '-' only for signed T. Unlike std::from_chars, a
+ * leading '+' is accepted, as parse_int always has. A value that does not
+ * fit T gives result_out_of_range with `ptr` past all its digits. `value`
+ * is written only on success.
+ */
+template <std::integral T, meta::character CharT>
+    requires (!std::same_as<T, bool>)
+constexpr from_chars_result<CharT> from_chars(const CharT* first, const CharT* last, T& value, int base = 10) noexcept {
+    std::errc ec{};
+    const CharT* end = detail::parsing::read(first, last, value, base, ec);
+    return {end, ec};
+}
+
+// parse_int's result: the value (0 unless ec is std::errc{}), the units
+// read, sign included, and the error. Converts to the value, so
+// `int n = parse_int<int>(s)` still reads as before
+template <std::integral T>
+    requires (!std::same_as<T, bool>)
+struct parse_result {
+    T value{};
+    std::size_t count = 0;
+    std::errc ec{};
+
+    constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
+    constexpr operator T() const noexcept { return value; }
+};
+
+// The leading integer in `str`. `count` is 0 when there is none, and
+// covers all the digits of a value out of range
+template <std::integral IntT, meta::character CharT>
+    requires (!std::same_as<IntT, bool>)
+constexpr parse_result<IntT> parse_int(std::basic_string_view<CharT> str, int base = 10) noexcept {
+    parse_result<IntT> result;
+    const CharT* end = detail::parsing::read(str.data(), str.data() + str.size(), result.value, base, result.ec);
+    result.count = static_cast<std::size_t>(end - str.data());
+    return result;
+}
+
 template <std::integral IntT, meta::character CharT, std::size_t Cap>
-constexpr IntT parse_int(const basic_fstring<CharT, Cap>& str, int base = 10) noexcept {
-    if (str.empty()) return IntT{};
-    
-    IntT result = 0;
-    std::size_t i = 0;
-    bool negative = false;
-    
-    if constexpr (std::is_signed_v<IntT>) {
-        if (str[0] == CharT('-')) {
-            negative = true;
-            ++i;
-        } else if (str[0] == CharT('+')) {
-            ++i;
-        }
-    }
-    
-    for (; i < str.size(); ++i) {
-        CharT ch = str[i];
-        int digit = -1;
-        
-        if (ch >= CharT('0') && ch <= CharT('9')) {
-            digit = ch - CharT('0');
-        } else if (ch >= CharT('a') && ch <= CharT('z')) {
-            digit = 10 + (ch - CharT('a'));
-        } else if (ch >= CharT('A') && ch <= CharT('Z')) {
-            digit = 10 + (ch - CharT('A'));
-        }
-        
-        if (digit < 0 || digit >= base) break;
-        result = result * base + digit;
-    }
-    
-    return negative ? -result : result;
+    requires (!std::same_as<IntT, bool>)
+constexpr parse_result<IntT> parse_int(const basic_fstring<CharT, Cap>& str, int base = 10) noexcept {
+    return parse_int<IntT>(std::basic_string_view<CharT>{str.data(), str.size()}, base);
+}
+
+// The leading number in `str`, rounded; 0 when there is none. A value
+// out of range reads as the zero or infinity it rounds to
+template <std::floating_point FloatT, meta::character CharT>
+constexpr FloatT parse_float(std::basic_string_view<CharT> str) noexcept {
+    FloatT result{};
+    std::errc ec{};
+    detail::parsing::read(str.data(), str.data() + str.size(), result, ec);
+    return result;
 }
 
 template <std::floating_point FloatT, meta::character CharT, std::size_t Cap>
 constexpr FloatT parse_float(const basic_fstring<CharT, Cap>& str) noexcept {
-    if (str.empty()) return FloatT{};
-    
-    FloatT result = 0;
-    std::size_t i = 0;
-    bool negative = false;
-    
-    if (str[0] == CharT('-')) {
-        negative = true;
-        ++i;
-    } else if (str[0] == CharT('+')) {
-        ++i;
-    }
-    
-    while (i < str.size() && str[i] >= CharT('0') && str[i] <= CharT('9')) {
-        result = result * 10 + (str[i] - CharT('0'));
-        ++i;
-    }
-    
-    if (i < str.size() && str[i] == CharT('.')) {
-        ++i;
-        FloatT fraction = FloatT(0.1);
-        while (i < str.size() && str[i] >= CharT('0') && str[i] <= CharT('9')) {
-            result += (str[i] - CharT('0')) * fraction;
-            fraction *= FloatT(0.1);
-            ++i;
-        }
-    }
-    
-    return negative ? -result : result;
+    return parse_float<FloatT>(std::basic_string_view<CharT>{str.data(), str.size()});
 }
 
 } // namespace zuu::fmt
\ No newline at end of file
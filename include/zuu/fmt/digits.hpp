@@ -0,0 +1,304 @@
+#pragma once
+
+/**
+ * @file zuu/fmt/digits.hpp
+ * @brief Decimal digit counting, writing and reading for the number
+ *        formatters and parsers
+ * @version 3.0.0
+ *
+ * Design Philosophy:
+ * - The length is known before the first digit is written, so every
+ *   digit lands at its final position: no reversed temporary, no
+ *   push_back per digit
+ * - Digits come two at a time from a 200-byte "00".."99" table
+ * - A chunk of up to 8 digits is turned into a 57-bit binary fraction by
+ *   one multiply (jeaiii's scheme); each further multiply by 100 moves
+ *   the next pair into the integer part, so there is no division and no
+ *   branch per digit. 64-bit values are split into 8-digit chunks first
+ * - The leading chunk is written without a branch on its length when the
+ *   destination has 8 units of room (write_head); write<true> is the
+ *   exact form for tight buffers
+ * - Reading goes 8 digits at a time for byte-sized characters: one word
+ *   load, one check that all 8 bytes are digits, three multiplies (SWAR),
+ *   in bases 2, 8, 10 and 16
+ * - Plain integer arithmetic throughout, so all of it is constexpr
+ *
+ * Usage:
+ *   const unsigned len = detail::digits::count(value);
+ *   detail::digits::write(out, value, len);        // out[0, len), scratch to out[8)
+ *   detail::digits::write<true>(out, value, len);  // out[0, len) only
+ *   const std::uint64_t word = detail::digits::load8(p);
+ *   if (detail::digits::all_digits8(word)) value = detail::digits::read8(word);
+ *   const unsigned n = detail::digits::leading_digits8(word);  // then read_leading8
+ */
+
+#include "../meta/concepts.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace zuu::detail::digits {
+
+// ==================== Tables ====================
+
+inline constexpr char pairs[200] = {
+    '0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+    '1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+    '2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+    '3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+    '4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+    '5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+    '6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+    '7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+    '8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+    '9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9',
+};
+
+inline constexpr std::uint64_t pow10[20] = {
+    1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull,
+    100000000ull, 1000000000ull, 10000000000ull, 100000000000ull,
+    1000000000000ull, 10000000000000ull, 100000000000000ull,
+    1000000000000000ull, 10000000000000000ull, 100000000000000000ull,
+    1000000000000000000ull, 10000000000000000000ull,
+};
+
+// ==================== Counting ====================
+
+/**
+ * @brief Number of decimal digits in `value` (1 for 0)
+ *
+ * The bit length times log10(2) (1233 / 4096) is the digit count or one
+ * more; a single table compare settles which.
+ */
+constexpr unsigned count(std::uint64_t value) noexcept {
+    value |= 1;
+    const unsigned t = static_cast<unsigned>(std::bit_width(value)) * 1233 >> 12;
+    return t + 1 - (value < pow10[t]);
+}
+
+// ==================== Writing ====================
+
+inline constexpr unsigned fraction_bits = 57;
+
+// ceil(2^57 / 10^m): x * scale<m> holds x / 10^m with a 57-bit fraction
+// exact enough for 8-digit x to yield m more digits
+template <unsigned M>
+inline constexpr std::uint64_t scale =
+    (std::uint64_t{1} << fraction_bits) / pow10[M] +
+    ((std::uint64_t{1} << fraction_bits) % pow10[M] != 0);
+
+template <meta::character CharT>
+constexpr void put2(CharT* out, std::uint64_t pair) noexcept {
+    out[0] = static_cast<CharT>(pairs[2 * pair]);
+    out[1] = static_cast<CharT>(pairs[2 * pair + 1]);
+}
+
+// Pairs left in the fraction of `y`, one multiply by 100 each
+template <unsigned Pairs, meta::character CharT>
+constexpr void put_fraction(CharT* out, std::uint64_t y) noexcept {
+    constexpr std::uint64_t mask = (std::uint64_t{1} << fraction_bits) - 1;
+    for (unsigned i = 0; i < Pairs; ++i) {
+        y = (y & mask) * 100;
+        put2(out + 2 * i, y >> fraction_bits);
+    }
+}
+
+// `value` with M digits after a leading digit (Lead = 1) or pair (Lead = 2)
+template <unsigned Lead, unsigned M, meta::character CharT>
+constexpr void write_led(CharT* out, std::uint32_t value) noexcept {
+    const std::uint64_t y = value * scale<M>;
+    if constexpr (Lead == 1) {
+        out[0] = static_cast<CharT>('0' + (y >> fraction_bits));
+    } else {
+        put2(out, y >> fraction_bits);
+    }
+    put_fraction<M / 2>(out + Lead, y);
+}
+
+/**
+ * @brief Write `value` < 10^8 as exactly 8 digits, leading zeros included
+ */
+template <meta::character CharT>
+constexpr void write8(CharT* out, std::uint32_t value) noexcept {
+    write_led<2, 6>(out, value);
+}
+
+/**
+ * @brief Write `value` < 10^8, which has `len` digits, to [out, out + len)
+ *        and nothing past it
+ */
+template <meta::character CharT>
+constexpr void write_short(CharT* out, std::uint32_t value, unsigned len) noexcept {
+    switch (len) {
+        case 1: out[0] = static_cast<CharT>('0' + value); break;
+        case 2: put2(out, value); break;
+        case 3: write_led<1, 2>(out, value); break;
+        case 4: write_led<2, 2>(out, value); break;
+        case 5: write_led<1, 4>(out, value); break;
+        case 6: write_led<2, 4>(out, value); break;
+        case 7: write_led<1, 6>(out, value); break;
+        default: write8(out, value); break;
+    }
+}
+
+inline constexpr std::uint64_t scales[4] = {scale<0>, scale<2>, scale<4>, scale<6>};
+
+/**
+ * @brief Write `value` < 10^8, which has `len` digits, to [out, out + len)
+ *        without branching on `len`
+ *
+ * The parity of `len` picks a leading digit or pair, and all three
+ * fraction pairs are written whatever the length, so random lengths cost
+ * no misprediction. [out, out + 8) must be writable; units past `len`
+ * are scratch.
+ */
+template <meta::character CharT>
+constexpr void write_head(CharT* out, std::uint32_t value, unsigned len) noexcept {
+    const unsigned odd = len & 1;
+    const std::uint64_t y = value * scales[(len - 1) >> 1];
+    const std::uint64_t lead = y >> fraction_bits;
+    out[0] = static_cast<CharT>(pairs[2 * lead + odd]);
+    out[1] = static_cast<CharT>(pairs[2 * lead + 1]);
+    put_fraction<3>(out + 2 - odd, y);
+}
+
+// Values of 9-20 digits: the leading chunk, then whole 8-digit chunks
+template <bool Exact, meta::character CharT>
+constexpr void write_long(CharT* out, std::uint64_t value, unsigned len) noexcept {
+    // The leading chunk goes first: its scratch is overwritten by the rest
+    const auto head = [out](std::uint64_t chunk, unsigned n) {
+        if constexpr (Exact) {
+            write_short(out, static_cast<std::uint32_t>(chunk), n);
+        } else {
+            write_head(out, static_cast<std::uint32_t>(chunk), n);
+        }
+    };
+
+    const std::uint64_t high = value / 100000000;
+    if (len <= 16) {
+        head(high, len - 8);
+    } else {
+        const std::uint64_t top = high / 100000000;
+        head(top, len - 16);
+        write8(out + len - 16, static_cast<std::uint32_t>(high - top * 100000000));
+    }
+    write8(out + len - 8, static_cast<std::uint32_t>(value - high * 100000000));
+}
+
+/**
+ * @brief Write `value`, which has `len` digits (count(value)), to
+ *        [out, out + len)
+ *
+ * Exact = false takes write_head for the leading chunk: [out, out + 8)
+ * must then be writable even for shorter values, and units past `len`
+ * are scratch. Exact = true writes [out, out + len) only. A `len` above
+ * count(value) pads with leading zeros. Kept small so the common
+ * 8-digit-or-shorter case inlines into the caller.
+ */
+template <bool Exact = false, meta::character CharT>
+constexpr void write(CharT* out, std::uint64_t value, unsigned len) noexcept {
+    if (len > 8) {
+        write_long<Exact>(out, value, len);
+    } else if constexpr (Exact) {
+        write_short(out, static_cast<std::uint32_t>(value), len);
+    } else {
+        write_head(out, static_cast<std::uint32_t>(value), len);
+    }
+}
+
+// ==================== Reading ====================
+
+/**
+ * @brief Units p[0..8) as a little-endian word: p[i] in byte i
+ *
+ * Composed byte by byte, so it is constexpr and endian-independent; the
+ * compiler turns it into one unaligned load.
+ */
+template <meta::character CharT>
+    requires (sizeof(CharT) == 1)
+constexpr std::uint64_t load8(const CharT* p) noexcept {
+    const auto at = [p](unsigned i) {
+        return std::uint64_t{static_cast<unsigned char>(p[i])} << (8 * i);
+    };
+    return at(0) | at(1) | at(2) | at(3) | at(4) | at(5) | at(6) | at(7);
+}
+
+inline constexpr std::uint64_t ones8 = 0x0101010101010101ull;
+inline constexpr std::uint64_t high8 = 0x8080808080808080ull;
+
+// Top bit of each byte of `word` (all below 0x80) that is in [lo, hi]:
+// adding 0x80 - lo reaches the top bit from lo up, adding 0x7F - hi
+// from hi + 1 up, and neither carries into the next byte
+constexpr std::uint64_t in_range8(std::uint64_t word, unsigned lo, unsigned hi) noexcept {
+    return (word + ones8 * (0x80 - lo)) & ~(word + ones8 * (0x7F - hi)) & high8;
+}
+
+/**
+ * @brief All 8 bytes of `word` are digits of `Base` (2, 8, 10 or 16;
+ *        hex digits in either case)
+ *
+ * Base 10 needs no range check first: subtracting '0' sets a byte's top
+ * bit below '0' and adding 0x46 sets it above '9'. A borrow or carry
+ * between bytes only starts at a byte that is already flagged.
+ */
+template <unsigned Base = 10>
+constexpr bool all_digits8(std::uint64_t word) noexcept {
+    static_assert(Base == 2 || Base == 8 || Base == 10 || Base == 16);
+    if constexpr (Base == 10) {
+        return (((word + 0x4646464646464646ull) | (word - 0x3030303030303030ull)) & high8) == 0;
+    } else if constexpr (Base == 16) {
+        return (word & high8) == 0 &&
+               (in_range8(word, '0', '9') | in_range8(word | 0x2020202020202020ull, 'a', 'f')) == high8;
+    } else {
+        return (word & high8) == 0 && in_range8(word, '0', '0' + Base - 1) == high8;
+    }
+}
+
+/**
+ * @brief The value of 8 digits of `Base` in `word` (all_digits8), first
+ *        digit in the low byte
+ *
+ * Adjacent digits combine into pairs, pairs into quads and quads into
+ * the result, each step one multiply across the whole word. Hex letters
+ * are told apart from digits by their 0x40 bit.
+ */
+template <unsigned Base = 10>
+constexpr std::uint32_t read8(std::uint64_t word) noexcept {
+    constexpr std::uint64_t b2 = Base * Base, b4 = b2 * b2;
+    constexpr std::uint64_t mask = 0x000000FF000000FFull;
+    constexpr std::uint64_t mul1 = b2 + ((b4 * b2) << 32);
+    constexpr std::uint64_t mul2 = 1 + (b4 << 32);
+    if constexpr (Base == 16) {
+        word = (word & 0x0F0F0F0F0F0F0F0Full) + 9 * ((word >> 6) & ones8);
+    } else {
+        word -= 0x3030303030303030ull;
+    }
+    word = word * Base + (word >> 8);
+    return static_cast<std::uint32_t>(
+        ((word & mask) * mul1 + ((word >> 16) & mask) * mul2) >> 32);
+}
+
+/**
+ * @brief Number of leading bytes of `word` that are '0'..'9', 8 when all
+ *        are
+ *
+ * The all_digits8 flags, lowest first: a borrow or carry only travels
+ * up from a flagged byte, so the first flag is always a true one.
+ */
+constexpr unsigned leading_digits8(std::uint64_t word) noexcept {
+    const std::uint64_t flags = ((word + 0x4646464646464646ull) | (word - 0x3030303030303030ull)) & high8;
+    return static_cast<unsigned>(std::countr_zero(flags)) / 8;
+}
+
+/**
+ * @brief The value of the first `n` digits of `word`, n in [1, 7]
+ *        (leading_digits8)
+ *
+ * Shifting them to the top and filling '0' in behind turns them into an
+ * 8-digit read with the same value, whatever `n` is.
+ */
+constexpr std::uint32_t read_leading8(std::uint64_t word, unsigned n) noexcept {
+    return read8((word << (64 - 8 * n)) | (0x3030303030303030ull >> (8 * n)));
+}
+
+} // namespace zuu::detail::digits
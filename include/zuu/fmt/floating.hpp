@@ -0,0 +1,683 @@
+#pragma once
+
+/**
+ * @file zuu/fmt/floating.hpp
+ * @brief Floating-point to decimal: shortest round-trip digits and exactly
+ *        rounded fixed, scientific and general notation
+ * @version 3.0.0
+ *
+ * Design Philosophy:
+ * - Shortest output comes from Schubfach (Giulietti): one 128-bit power
+ *   of ten (pow10_table.hpp), three multiplies and no loop give the
+ *   shortest digits that read back as the same value, the closest such
+ *   digits when there is a choice
+ * - Output with a precision is the binary value rounded half to even, as
+ *   printf does. When the scaled value fits in 64 bits one 64 x 64
+ *   multiply and a shift produce it; otherwise a fixed-size bignum does,
+ *   so 1e300 in fixed notation is exact too
+ * - Digits are laid out by one routine per notation and written through
+ *   a bounded sink: output that does not fit is cut, never overrun
+ * - std::bit_cast and integer arithmetic only, so all of it is constexpr
+ *
+ * Usage:
+ *   CharT* end = detail::floating::write(first, last, 0.1);   // "0.1"
+ *   end = detail::floating::write(first, last, 0.1, notation::fixed, 20);
+ *   // "0.10000000000000000555"
+ */
+
+#include "../meta/concepts.hpp"
+#include "digits.hpp"
+#include "pow10_table.hpp"
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace zuu::detail::floating {
+
+// ==================== Decomposition ====================
+
+template <typename T>
+struct ieee;
+
+template <>
+struct ieee<float> {
+    using bits_type = std::uint32_t;
+    static constexpr int significand_bits = 23;
+    static constexpr int exponent_bits = 8;
+};
+
+template <>
+struct ieee<double> {
+    using bits_type = std::uint64_t;
+    static constexpr int significand_bits = 52;
+    static constexpr int exponent_bits = 11;
+};
+
+// float and double natively; long double is formatted as a double
+template <std::floating_point T>
+using binary_t = std::conditional_t<std::is_same_v<T, float>, float, double>;
+
+enum class category : unsigned char { finite, zero, infinity, nan };
+
+struct decomposed {
+    std::uint64_t c = 0;       // value = c * 2^q
+    int q = 0;
+    bool negative = false;
+    bool lower_closer = false; // c = 2^p: the next value down is half as far
+    category kind = category::finite;
+};
+
+template <std::floating_point T>
+constexpr decomposed decompose(T value) noexcept {
+    using B = ieee<binary_t<T>>;
+    constexpr int bias = (1 << (B::exponent_bits - 1)) - 1;
+    constexpr int max_exponent = (1 << B::exponent_bits) - 1;
+
+    const auto bits = std::bit_cast<typename B::bits_type>(static_cast<binary_t<T>>(value));
+    const std::uint64_t m = bits & ((typename B::bits_type{1} << B::significand_bits) - 1);
+    const int e = static_cast<int>(bits >> B::significand_bits) & max_exponent;
+
+    decomposed d;
+    d.negative = (bits >> (B::significand_bits + B::exponent_bits)) != 0;
+    if (e == max_exponent) {
+        d.kind = m ? category::nan : category::infinity;
+    } else if (e == 0) {
+        d.c = m;
+        d.q = 1 - bias - B::significand_bits;
+        d.kind = m ? category::finite : category::zero;
+    } else {
+        d.c = m | (std::uint64_t{1} << B::significand_bits);
+        d.q = e - bias - B::significand_bits;
+        d.lower_closer = m == 0 && e > 1;
+    }
+    return d;
+}
+
+// ==================== 128-bit Arithmetic ====================
+
+struct uint128 {
+    std::uint64_t hi;
+    std::uint64_t lo;
+};
+
+constexpr uint128 umul128(std::uint64_t a, std::uint64_t b) noexcept {
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 wide;
+    const wide r = static_cast<wide>(a) * b;
+    return {static_cast<std::uint64_t>(r >> 64), static_cast<std::uint64_t>(r)};
+#else
+    const std::uint64_t ha = a >> 32, hb = b >> 32;
+    const std::uint64_t la = a & 0xFFFFFFFFull, lb = b & 0xFFFFFFFFull;
+    const std::uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    const std::uint64_t t = rl + (rm0 << 32);
+    std::uint64_t carry = t < rl;
+    const std::uint64_t lo = t + (rm1 << 32);
+    carry += lo < t;
+    return {rh + (rm0 >> 32) + (rm1 >> 32) + carry, lo};
+#endif
+}
+
+// m >> s, s in [0, 127]
+constexpr uint128 shift_right(uint128 m, unsigned s) noexcept {
+    if (s == 0) return m;
+    if (s < 64) return {m.hi >> s, (m.lo >> s) | (m.hi << (64 - s))};
+    return {0, m.hi >> (s - 64)};
+}
+
+// Any of the low `s` bits of m set, s in [0, 127]
+constexpr bool low_bits(uint128 m, unsigned s) noexcept {
+    if (s < 64) return (m.lo & ((std::uint64_t{1} << s) - 1)) != 0;
+    return m.lo != 0 || (m.hi & ((std::uint64_t{1} << (s - 64)) - 1)) != 0;
+}
+
+inline constexpr std::uint64_t pow5[28] = {
+    1ull, 5ull, 25ull, 125ull, 625ull, 3125ull, 15625ull, 78125ull, 390625ull,
+    1953125ull, 9765625ull, 48828125ull, 244140625ull, 1220703125ull,
+    6103515625ull, 30517578125ull, 152587890625ull, 762939453125ull,
+    3814697265625ull, 19073486328125ull, 95367431640625ull, 476837158203125ull,
+    2384185791015625ull, 11920928955078125ull, 59604644775390625ull,
+    298023223876953125ull, 1490116119384765625ull, 7450580596923828125ull,
+};
+
+// ==================== Shortest Digits ====================
+
+struct decimal {
+    std::uint64_t digits; // value = digits * 10^exponent
+    int exponent;
+};
+
+constexpr int floor_log10_pow2(int e) noexcept { return (e * 315653) >> 20; }
+constexpr int floor_log10_three_quarters_pow2(int e) noexcept { return (e * 315653 - 131237) >> 20; }
+constexpr int floor_log2_pow10(int e) noexcept { return (e * 1741647) >> 19; }
+
+// The table entry plus one: never below 10^k
+constexpr pow10::entry upper_pow10(int k) noexcept {
+    pow10::entry g = pow10::table[k - pow10::min_exponent];
+    ++g.lo;
+    g.hi += g.lo == 0;
+    return g;
+}
+
+// g * cp / 2^128, rounded to odd: the low bit says "inexact". g is above
+// the true power by under one unit, which adds at most 1 to the middle
+// word of an exact product, so only z > 1 counts as a remainder
+constexpr std::uint64_t round_to_odd(pow10::entry g, std::uint64_t cp) noexcept {
+    const uint128 x = umul128(g.lo, cp);
+    const uint128 y = umul128(g.hi, cp);
+    const std::uint64_t z = y.lo + x.hi;
+    return (y.hi + (z < y.lo)) | (z > 1);
+}
+
+// Strips factors of 10 with no division: d * 5^-2 (mod 2^64) rotated
+// right by 2 is d / 100 when 100 divides d, and something above
+// 2^64 / 100 otherwise (Granlund-Montgomery)
+constexpr decimal remove_trailing_zeros(decimal d) noexcept {
+    constexpr std::uint64_t inv5 = 0xCCCCCCCCCCCCCCCDull;
+    constexpr std::uint64_t inv25 = inv5 * inv5;
+    for (;;) {
+        const std::uint64_t q = std::rotr(d.digits * inv25, 2);
+        if (q > ~std::uint64_t{0} / 100) break;
+        d.digits = q;
+        d.exponent += 2;
+    }
+    const std::uint64_t q = std::rotr(d.digits * inv5, 1);
+    if (q <= ~std::uint64_t{0} / 10) {
+        d.digits = q;
+        d.exponent += 1;
+    }
+    return d;
+}
+
+/**
+ * @brief Shortest decimal that rounds back to c * 2^q (c > 0), the
+ *        closest to it when several qualify, ties to even
+ *
+ * The rounding interval and the value are scaled by 10^-k, k chosen so
+ * the interval is 1 to 10 units wide, and kept in quarter units so its
+ * bounds are exact: then either one multiple of 10 lies inside (one
+ * digit fewer) or the answer is s or s + 1.
+ */
+constexpr decimal shortest(std::uint64_t c, int q, bool lower_closer) noexcept {
+    const bool even = (c & 1) == 0;
+    const std::uint64_t cb = c << 2;
+    const std::uint64_t cbl = cb - 2 + lower_closer;
+    const std::uint64_t cbr = cb + 2;
+
+    const int k = lower_closer ? floor_log10_three_quarters_pow2(q) : floor_log10_pow2(q);
+    const int h = q + floor_log2_pow10(-k) + 1;
+    const pow10::entry g = upper_pow10(-k);
+
+    const std::uint64_t vb = round_to_odd(g, cb << h);
+    const std::uint64_t lower = round_to_odd(g, cbl << h) + !even;
+    const std::uint64_t upper = round_to_odd(g, cbr << h) - !even;
+
+    const std::uint64_t s = vb >> 2;
+    if (s >= 10) {
+        const std::uint64_t sp = s / 10;
+        const bool up_inside = lower <= 40 * sp;
+        const bool wp_inside = 40 * sp + 40 <= upper;
+        if (up_inside != wp_inside) {
+            return remove_trailing_zeros({sp + wp_inside, k + 1});
+        }
+    }
+
+    const bool u_inside = lower <= 4 * s;
+    const bool w_inside = 4 * s + 4 <= upper;
+    const std::uint64_t mid = 4 * s + 2;
+    const std::uint64_t r = u_inside != w_inside ? s + w_inside
+                          : s + (vb > mid || (vb == mid && (s & 1) != 0));
+    // Only the smallest subnormals, with s below 10, end in a zero here
+    return r % 10 == 0 ? remove_trailing_zeros({r, k}) : decimal{r, k};
+}
+
+// ==================== Exact Rounding ====================
+
+// Big enough for c * 5^1074, the largest value exact rounding scales to
+struct bignum {
+    static constexpr unsigned capacity = 84;
+
+    std::uint32_t limbs[capacity]{};
+    unsigned size = 0;
+
+    constexpr explicit bignum(std::uint64_t v) noexcept {
+        while (v) {
+            limbs[size++] = static_cast<std::uint32_t>(v);
+            v >>= 32;
+        }
+    }
+
+    constexpr bool odd() const noexcept { return size != 0 && (limbs[0] & 1) != 0; }
+
+    constexpr void trim() noexcept {
+        while (size && limbs[size - 1] == 0) --size;
+    }
+
+    constexpr void multiply(std::uint32_t m) noexcept {
+        std::uint64_t carry = 0;
+        for (unsigned i = 0; i < size; ++i) {
+            const std::uint64_t p = std::uint64_t{limbs[i]} * m + carry;
+            limbs[i] = static_cast<std::uint32_t>(p);
+            carry = p >> 32;
+        }
+        if (carry) limbs[size++] = static_cast<std::uint32_t>(carry);
+    }
+
+    constexpr void multiply_pow5(unsigned e) noexcept {
+        for (; e >= 13; e -= 13) multiply(static_cast<std::uint32_t>(pow5[13]));
+        if (e) multiply(static_cast<std::uint32_t>(pow5[e]));
+    }
+
+    // Returns the remainder
+    constexpr std::uint32_t divide(std::uint32_t d) noexcept {
+        std::uint64_t r = 0;
+        for (unsigned i = size; i-- > 0;) {
+            const std::uint64_t cur = (r << 32) | limbs[i];
+            limbs[i] = static_cast<std::uint32_t>(cur / d);
+            r = cur % d;
+        }
+        trim();
+        return static_cast<std::uint32_t>(r);
+    }
+
+    // Returns whether the division was inexact
+    constexpr bool divide_pow5(unsigned e) noexcept {
+        bool inexact = false;
+        for (; e >= 13; e -= 13) inexact |= divide(static_cast<std::uint32_t>(pow5[13])) != 0;
+        if (e) inexact |= divide(static_cast<std::uint32_t>(pow5[e])) != 0;
+        return inexact;
+    }
+
+    constexpr void shift_left(unsigned n) noexcept {
+        if (size == 0) return;
+        const unsigned words = n / 32, bits = n % 32;
+        const std::uint32_t carry = bits ? limbs[size - 1] >> (32 - bits) : 0;
+        for (unsigned i = size; i-- > 0;) {
+            const std::uint32_t below = bits && i > 0 ? limbs[i - 1] >> (32 - bits) : 0;
+            limbs[i + words] = (limbs[i] << bits) | below;
+        }
+        for (unsigned i = 0; i < words; ++i) limbs[i] = 0;
+        size += words;
+        if (carry) limbs[size++] = carry;
+    }
+
+    // Returns whether any set bit was shifted out
+    constexpr bool shift_right(unsigned n) noexcept {
+        const unsigned words = n / 32, bits = n % 32;
+        bool lost = false;
+        for (unsigned i = 0; i < words && i < size; ++i) lost |= limbs[i] != 0;
+        if (words >= size) {
+            for (unsigned i = 0; i < size; ++i) limbs[i] = 0;
+            size = 0;
+            return lost;
+        }
+        lost |= bits && (limbs[words] & ((std::uint32_t{1} << bits) - 1)) != 0;
+        const unsigned kept = size - words;
+        for (unsigned i = 0; i < kept; ++i) {
+            const std::uint32_t above = bits && i + words + 1 < size ? limbs[i + words + 1] << (32 - bits) : 0;
+            limbs[i] = (limbs[i + words] >> bits) | above;
+        }
+        for (unsigned i = kept; i < size; ++i) limbs[i] = 0;
+        size = kept;
+        trim();
+        return lost;
+    }
+
+    constexpr void increment() noexcept {
+        for (unsigned i = 0; i < size; ++i) {
+            if (++limbs[i] != 0) return;
+        }
+        limbs[size++] = 1;
+    }
+
+    // Decimal digits, right-aligned at `last`; consumes the value
+    constexpr char* to_chars(char* last) noexcept {
+        char* p = last;
+        do {
+            p -= 9;
+            digits::write<true>(p, divide(1000000000), 9);
+        } while (size != 0);
+        while (p < last - 1 && *p == '0') ++p;
+        return p;
+    }
+};
+
+// Room for the digits of any exactly rounded double (at most 767), in
+// whole 9-digit groups
+inline constexpr unsigned digit_capacity = 792;
+
+// round_half_even(c * 2^q * 10^t) in 64 bits: c * 5^t is one multiply
+// and 2^(q + t) a shift. False when it does not fit
+constexpr bool scale_fast(std::uint64_t c, int q, int t, std::uint64_t& n) noexcept {
+    if (t < 0 || t > 27) return false;
+    const uint128 m = umul128(c, pow5[t]);
+    const int e2 = q + t;
+    if (e2 >= 0) {
+        if (m.hi != 0 || e2 > 62 || (m.lo >> (63 - e2)) != 0) return false;
+        n = m.lo << e2;
+        return true;
+    }
+    const unsigned s = static_cast<unsigned>(-e2);
+    if (s > 127) return false;
+    const uint128 twice = shift_right(m, s - 1);
+    if (twice.hi != 0) return false;
+    n = twice.lo >> 1;
+    if ((twice.lo & 1) && (low_bits(m, s - 1) || (n & 1))) ++n;
+    return true;
+}
+
+// round_half_even(c * 2^q * 10^t) with a bignum: floor(2x) gives the
+// rounding bit, and every shift or division reports what it dropped
+constexpr char* scale_exact(std::uint64_t c, int q, int t, char* last) noexcept {
+    bignum n{c};
+    if (t > 0) n.multiply_pow5(static_cast<unsigned>(t));
+    const int e2 = q + t + 1;
+    bool inexact = false;
+    if (e2 >= 0) {
+        n.shift_left(static_cast<unsigned>(e2));
+    } else {
+        inexact = n.shift_right(static_cast<unsigned>(-e2));
+    }
+    if (t < 0) inexact |= n.divide_pow5(static_cast<unsigned>(-t));
+    const bool half = n.odd();
+    n.shift_right(1);
+    if (half && (inexact || n.odd())) n.increment();
+    return n.to_chars(last);
+}
+
+/**
+ * @brief Digits of round_half_even(c * 2^q * 10^t), right-aligned at
+ *        `last` ([last - digit_capacity, last) must be writable)
+ *
+ * t must not exceed max(-q, 0): past that the scaled value is an integer
+ * and further digits are zeros the caller appends.
+ */
+constexpr char* scale(std::uint64_t c, int q, int t, char* last) noexcept {
+    std::uint64_t n = 0;
+    if (scale_fast(c, q, t, n)) {
+        const unsigned len = digits::count(n);
+        digits::write<true>(last - len, n, len);
+        return last - len;
+    }
+    return scale_exact(c, q, t, last);
+}
+
+// ==================== Output ====================
+
+enum class notation : unsigned char { plain, fixed, scientific, general };
+
+// Writes into [pos, end) and silently drops what does not fit
+template <meta::character CharT>
+struct sink {
+    CharT* pos;
+    CharT* end;
+
+    constexpr bool room(std::size_t n) const noexcept {
+        return static_cast<std::size_t>(end - pos) >= n;
+    }
+
+    constexpr void put(char ch) noexcept {
+        if (pos != end) *pos++ = static_cast<CharT>(ch);
+    }
+
+    constexpr void fill(std::size_t n, char ch) noexcept {
+        for (; n && pos != end; --n) *pos++ = static_cast<CharT>(ch);
+    }
+
+    constexpr void copy(const char* s, std::size_t n) noexcept {
+        for (; n && pos != end; --n) *pos++ = static_cast<CharT>(*s++);
+    }
+};
+
+/**
+ * @brief d[0, n) as a number whose first digit is at 10^x, with `places`
+ *        digits after the point (zero-padded; no point when 0)
+ */
+template <meta::character CharT>
+constexpr void put_fixed(sink<CharT>& out, const char* d, int n, int x, int places) noexcept {
+    int leading = 0;
+    if (x >= 0) {
+        const int whole = x + 1;
+        if (n <= whole) {
+            out.copy(d, static_cast<std::size_t>(n));
+            out.fill(static_cast<std::size_t>(whole - n), '0');
+            n = 0;
+        } else {
+            out.copy(d, static_cast<std::size_t>(whole));
+            d += whole;
+            n -= whole;
+        }
+    } else {
+        out.put('0');
+        leading = -x - 1;
+    }
+    if (places > 0) {
+        out.put('.');
+        out.fill(static_cast<std::size_t>(leading), '0');
+        out.copy(d, static_cast<std::size_t>(n));
+        out.fill(static_cast<std::size_t>(places - leading - n), '0');
+    }
+}
+
+// d[0] '.' d[1, n) padded to `places`, then e+XX
+template <meta::character CharT>
+constexpr void put_scientific(sink<CharT>& out, const char* d, int n, int x, int places) noexcept {
+    out.put(d[0]);
+    if (places > 0) {
+        out.put('.');
+        out.copy(d + 1, static_cast<std::size_t>(n - 1));
+        out.fill(static_cast<std::size_t>(places - (n - 1)), '0');
+    }
+    out.put('e');
+    out.put(x < 0 ? '-' : '+');
+    const unsigned e = static_cast<unsigned>(x < 0 ? -x : x);
+    if (e >= 100) out.put(static_cast<char>('0' + e / 100));
+    out.put(digits::pairs[2 * (e % 100)]);
+    out.put(digits::pairs[2 * (e % 100) + 1]);
+}
+
+// Exact integer digits of c * 2^q, q > 0
+template <meta::character CharT>
+constexpr void put_integer(sink<CharT>& out, const decomposed& v) noexcept {
+    char buf[digit_capacity];
+    char* const last = buf + digit_capacity;
+    const char* first = scale(v.c, v.q, 0, last);
+    out.copy(first, static_cast<std::size_t>(last - first));
+}
+
+// Direct layouts of shortest digits, for text known to fit with the
+// 8 units of scratch digits::write may use
+template <meta::character CharT>
+constexpr CharT* direct_scientific(CharT* p, std::uint64_t d, int n, int x) noexcept {
+    digits::write(p + 1, d, static_cast<unsigned>(n));
+    p[0] = p[1];
+    if (n > 1) {
+        p[1] = CharT('.');
+        p += n + 1;
+    } else {
+        p += 1;
+    }
+    *p++ = CharT('e');
+    *p++ = CharT(x < 0 ? '-' : '+');
+    const unsigned e = static_cast<unsigned>(x < 0 ? -x : x);
+    if (e >= 100) *p++ = static_cast<CharT>('0' + e / 100);
+    digits::put2(p, e % 100);
+    return p + 2;
+}
+
+template <meta::character CharT>
+constexpr CharT* direct_fixed(CharT* p, std::uint64_t d, int n, int x) noexcept {
+    if (x < 0) {
+        *p++ = CharT('0');
+        *p++ = CharT('.');
+        for (int i = 0; i < -x - 1; ++i) *p++ = CharT('0');
+        digits::write(p, d, static_cast<unsigned>(n));
+        return p + n;
+    }
+    if (n <= x + 1) {
+        digits::write(p, d, static_cast<unsigned>(n));
+        p += n;
+        for (int i = n; i < x + 1; ++i) *p++ = CharT('0');
+        return p;
+    }
+    // Digits one unit right, then the integer part back over the gap
+    digits::write(p + 1, d, static_cast<unsigned>(n));
+    for (int i = 0; i <= x; ++i) p[i] = p[i + 1];
+    p[x + 1] = CharT('.');
+    return p + n + 1;
+}
+
+template <meta::character CharT>
+constexpr void put_shortest(sink<CharT>& out, const decomposed& v, notation how) noexcept {
+    const decimal s = v.kind == category::zero ? decimal{0, 0} : shortest(v.c, v.q, v.lower_closer);
+    const int n = static_cast<int>(digits::count(s.digits));
+    const int x = s.exponent + n - 1;
+    const int sci_len = n + (n > 1) + 2 + (x >= 100 || x <= -100 ? 3 : 2);
+    const int fixed_len = x < 0 ? n + 1 - x : (n > x + 1 ? n + 1 : x + 1);
+
+    bool fixed = how == notation::fixed;
+    if (how == notation::general) {
+        fixed = x >= -4 && x < 6;
+    } else if (how == notation::plain) {
+        fixed = fixed_len <= sci_len; // the shorter, fixed on a tie
+    }
+
+    if (fixed && v.q > 0) {
+        // Past 2^53 every double is an integer: print that integer exactly
+        put_integer(out, v);
+    } else if (out.room(static_cast<std::size_t>(fixed ? fixed_len : sci_len) + 8)) {
+        out.pos = fixed ? direct_fixed(out.pos, s.digits, n, x)
+                        : direct_scientific(out.pos, s.digits, n, x);
+    } else {
+        char d[24];
+        digits::write(d, s.digits, static_cast<unsigned>(n));
+        if (fixed) {
+            put_fixed(out, d, n, x, n - 1 - x > 0 ? n - 1 - x : 0);
+        } else {
+            put_scientific(out, d, n, x, n - 1);
+        }
+    }
+}
+
+template <meta::character CharT>
+constexpr void put_fixed_precision(sink<CharT>& out, const decomposed& v, int places) noexcept {
+    const int exact = v.q < 0 ? -v.q : 0;
+    const int t = places < exact ? places : exact;
+
+    // Scaled value in 64 bits and room to spare: split it at the point
+    std::uint64_t n = 0;
+    if (scale_fast(v.c, v.q, t, n)) {
+        const std::uint64_t whole = t < 20 ? n / digits::pow10[t] : 0;
+        const std::uint64_t frac = t < 20 ? n - whole * digits::pow10[t] : n;
+        const unsigned wn = digits::count(whole);
+        if (out.room(wn + (places > 0 ? 1 + static_cast<std::size_t>(places) : 0) + 8)) {
+            CharT* p = out.pos;
+            digits::write(p, whole, wn);
+            p += wn;
+            if (places > 0) {
+                *p++ = CharT('.');
+                const int lead = t > 20 ? t - 20 : 0; // frac < 10^20
+                for (int i = 0; i < lead; ++i) *p++ = CharT('0');
+                if (t > lead) {
+                    digits::write(p, frac, static_cast<unsigned>(t - lead));
+                    p += t - lead;
+                }
+                for (int i = t; i < places; ++i) *p++ = CharT('0');
+            }
+            out.pos = p;
+            return;
+        }
+    }
+
+    char buf[digit_capacity];
+    char* const last = buf + digit_capacity;
+    const char* first = scale(v.c, v.q, t, last);
+    const int len = static_cast<int>(last - first);
+    put_fixed(out, first, len, len - 1 - t, places);
+}
+
+// `sig` significant digits of v, exponent of the first in `x`
+constexpr const char* significant(const decomposed& v, int sig, char* last, int& x, int& n) noexcept {
+    if (v.kind == category::zero) {
+        *--last = '0';
+        n = 1;
+        x = 0;
+        return last;
+    }
+    // floor(log10(v)) is this or one more
+    const int estimate = floor_log10_pow2(v.q + static_cast<int>(std::bit_width(v.c)) - 1);
+    const int exact = v.q < 0 ? -v.q : 0;
+    int t = sig - 1 - estimate;
+    if (t > exact) t = exact;
+
+    const char* first = scale(v.c, v.q, t, last);
+    n = static_cast<int>(last - first);
+    if (n > sig) {
+        // One digit too many: the estimate was low or rounding carried
+        --t;
+        first = scale(v.c, v.q, t, last);
+        n = static_cast<int>(last - first);
+    }
+    x = n - 1 - t;
+    if (n > sig) n = sig; // 10^sig: the dropped digit is a zero
+    return first;
+}
+
+template <meta::character CharT>
+constexpr void put_precision(sink<CharT>& out, const decomposed& v, notation how, int precision) noexcept {
+    if (how == notation::fixed || how == notation::plain) {
+        put_fixed_precision(out, v, precision);
+        return;
+    }
+
+    char buf[digit_capacity];
+    int x = 0, n = 0;
+    if (how == notation::scientific) {
+        const char* d = significant(v, precision + 1, buf + digit_capacity, x, n);
+        put_scientific(out, d, n, x, precision);
+        return;
+    }
+
+    // General: precision significant digits, trailing zeros dropped;
+    // fixed while the exponent is in [-4, precision)
+    const int sig = precision == 0 ? 1 : precision;
+    const char* d = significant(v, sig, buf + digit_capacity, x, n);
+    while (n > 1 && d[n - 1] == '0') --n;
+    if (x >= -4 && x < sig) {
+        put_fixed(out, d, n, x, n - 1 - x > 0 ? n - 1 - x : 0);
+    } else {
+        put_scientific(out, d, n, x, n - 1);
+    }
+}
+
+/**
+ * @brief Format `value` into [first, last); returns the end of the text
+ *
+ * A negative precision asks for the shortest digits that round-trip,
+ * laid out in `how` (plain picks the shorter of fixed and scientific,
+ * general uses fixed for exponents in [-4, 6)). Otherwise precision is
+ * the digits after the point (fixed, scientific; plain means fixed) or
+ * the significant digits (general), rounded half to even as printf does.
+ * Output past `last` is cut.
+ */
+template <meta::character CharT, std::floating_point T>
+constexpr CharT* write(CharT* first, CharT* last, T value,
+                       notation how = notation::plain, int precision = -1) noexcept {
+    sink<CharT> out{first, last};
+    const decomposed v = decompose(value);
+    if (v.negative) out.put('-');
+
+    if (v.kind == category::infinity) {
+        out.copy("inf", 3);
+    } else if (v.kind == category::nan) {
+        out.copy("nan", 3);
+    } else if (precision < 0) {
+        put_shortest(out, v, how);
+    } else {
+        put_precision(out, v, how, precision);
+    }
+    return out.pos;
+}
+
+} // namespace zuu::detail::floating
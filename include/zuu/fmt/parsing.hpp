@@ -0,0 +1,705 @@
+#pragma once
+
+/**
+ * @file zuu/fmt/parsing.hpp
+ * @brief Text to numbers: integers with checked overflow, floating point
+ *        correctly rounded
+ * @version 3.0.0
+ *
+ * Design Philosophy:
+ * - The syntax is read once: sign, integer and fraction digits into one
+ *   64-bit significand (8 or 16 digits per step for byte-sized
+ *   characters, see accumulate), then the exponent. The result is the value
+ *   the text spells, rounded half to even, as strtod gives it
+ * - Three conversions, each taken only when the previous cannot decide:
+ *   - Clinger: a significand below 2^53 times an exact power of ten up
+ *     to 10^22 is one correctly rounded multiply or divide
+ *   - Eisel-Lemire: the significand times a 128-bit power of ten
+ *     (pow10_table.hpp) settles the rounding for nearly every other
+ *     input, and says so when it cannot
+ *   - A decimal of up to 800 digits scaled by powers of two until the
+ *     binary digits can be read off (the simple decimal conversion of
+ *     Go's strconv): halfway cases, subnormals, overflow and inputs with
+ *     more than 19 significant digits the first two could not round
+ * - Integers: bases 2, 8, 10 and 16 read 8 digits per step (16 for
+ *   base 10 on AVX2 targets) with no check per digit; the number of
+ *   significant digits tells overflow apart afterwards. Other bases take
+ *   one checked multiply-add per digit
+ * - Integer arithmetic only, so all of it is constexpr; the AVX2 path is
+ *   taken at run time only
+ *
+ * Usage:
+ *   double value;
+ *   std::errc ec;
+ *   const char* end = detail::parsing::read(first, last, value, ec);
+ *   end = detail::parsing::read(first, last, id, 16, ec);   // integral id
+ */
+
+#include "../core/simd.hpp"
+#include "../meta/concepts.hpp"
+#include "digits.hpp"
+#include "floating.hpp"
+#include "pow10_table.hpp"
+#include <bit>
+#include <cfloat>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+namespace zuu::detail::parsing {
+
+// ==================== Syntax ====================
+
+template <meta::character CharT>
+constexpr bool is_digit(CharT c) noexcept {
+    return c >= CharT('0') && c <= CharT('9');
+}
+
+// [p, last) starts with `word` (lower-case ASCII), in any case
+template <meta::character CharT>
+constexpr bool starts_with_word(const CharT* p, const CharT* last, const char* word, std::ptrdiff_t len) noexcept {
+    if (last - p < len) return false;
+    for (std::ptrdiff_t i = 0; i < len; ++i) {
+        CharT c = p[i];
+        if (c >= CharT('A') && c <= CharT('Z')) c = static_cast<CharT>(c + ('a' - 'A'));
+        if (c != static_cast<CharT>(word[i])) return false;
+    }
+    return true;
+}
+
+// Value of `c` as a digit in bases up to 36, 36 for anything else
+template <meta::character CharT>
+constexpr unsigned digit_value(CharT c) noexcept {
+    if (c >= CharT('0') && c <= CharT('9')) return static_cast<unsigned>(c - CharT('0'));
+    if (c >= CharT('a') && c <= CharT('z')) return static_cast<unsigned>(c - CharT('a')) + 10;
+    if (c >= CharT('A') && c <= CharT('Z')) return static_cast<unsigned>(c - CharT('A')) + 10;
+    return 36;
+}
+
+/**
+ * @brief Digits of `Base` from `p` into `w` (which wraps once full);
+ *        returns the end
+ *
+ * Byte-sized characters go 8 digits per step (digits::read8). In base 10
+ * the step that finds the end of the run also reads the digits before
+ * it, 8 at a time or 16 on AVX2 targets (simd::read_digits16), so short
+ * numbers take one step and no loop per digit.
+ */
+template <unsigned Base = 10, meta::character CharT>
+constexpr const CharT* accumulate(const CharT* p, const CharT* last, std::uint64_t& w) noexcept {
+    if constexpr (sizeof(CharT) == 1) {
+#if defined(ZUU_SIMD_AVX2)
+        if constexpr (Base == 10) {
+            if (!std::is_constant_evaluated()) {
+                while (last - p >= 16) {
+                    std::uint64_t chunk = 0;
+                    const unsigned n = simd::read_digits16(p, chunk);
+                    w = w * digits::pow10[n] + chunk;
+                    p += n;
+                    if (n < 16) return p;
+                }
+            }
+        }
+#endif
+        constexpr std::uint64_t step = std::uint64_t{Base * Base * Base * Base} * (Base * Base * Base * Base);
+        while (last - p >= 8) {
+            const std::uint64_t word = digits::load8(p);
+            if constexpr (Base == 10) {
+                // A shorter run ends here, read in the same step
+                const unsigned n = digits::leading_digits8(word);
+                if (n < 8) {
+                    if (n > 0) w = w * digits::pow10[n] + digits::read_leading8(word, n);
+                    return p + n;
+                }
+            } else if (!digits::all_digits8<Base>(word)) {
+                break;
+            }
+            w = w * step + digits::read8<Base>(word);
+            p += 8;
+        }
+    }
+    if constexpr (Base <= 10) {
+        for (; p != last && *p >= CharT('0') && *p < CharT('0' + Base); ++p) {
+            w = w * Base + static_cast<std::uint64_t>(*p - CharT('0'));
+        }
+    } else {
+        for (; p != last && digit_value(*p) < Base; ++p) w = w * Base + digit_value(*p);
+    }
+    return p;
+}
+
+template <meta::character CharT>
+struct number {
+    std::uint64_t w = 0;       // value = w * 10^q
+    std::int64_t q = 0;
+    bool negative = false;
+    bool truncated = false;    // over 19 significant digits: w holds the first 19
+    floating::category kind = floating::category::finite;
+    const CharT* integer = nullptr;   // digits before and after the point
+    const CharT* integer_end = nullptr;
+    const CharT* fraction = nullptr;
+    const CharT* fraction_end = nullptr;
+    std::int64_t exponent = 0;        // the written exponent
+};
+
+inline constexpr std::uint64_t min_19_digits = 1000000000000000000ull;
+
+/**
+ * @brief Read [sign] digits [. digits] [e [sign] digits], "inf",
+ *        "infinity" or "nan" ["(" chars ")"] from `first`
+ *
+ * Returns the end of the match, or `first` when there is none. An "e"
+ * without exponent digits after it is not part of the match. The leading
+ * sign may be '+', which std::from_chars does not allow.
+ */
+template <meta::character CharT>
+constexpr const CharT* scan(const CharT* first, const CharT* last, number<CharT>& n) noexcept {
+    const CharT* p = first;
+    if (p != last && (*p == CharT('-') || *p == CharT('+'))) {
+        n.negative = *p == CharT('-');
+        ++p;
+    }
+    if (p == last) return first;
+
+    if (!is_digit(*p) && *p != CharT('.')) {
+        if (starts_with_word(p, last, "inf", 3)) {
+            n.kind = floating::category::infinity;
+            p += 3;
+            return starts_with_word(p, last, "inity", 5) ? p + 5 : p;
+        }
+        if (starts_with_word(p, last, "nan", 3)) {
+            n.kind = floating::category::nan;
+            p += 3;
+            if (p != last && *p == CharT('(')) {
+                const CharT* q = p + 1;
+                while (q != last && (is_digit(*q) || *q == CharT('_') ||
+                                     (*q >= CharT('a') && *q <= CharT('z')) ||
+                                     (*q >= CharT('A') && *q <= CharT('Z')))) {
+                    ++q;
+                }
+                if (q != last && *q == CharT(')')) p = q + 1;
+            }
+            return p;
+        }
+        return first;
+    }
+
+    std::uint64_t w = 0;
+    n.integer = p;
+    p = n.integer_end = accumulate(p, last, w);
+    n.fraction = n.fraction_end = p;
+    if (p != last && *p == CharT('.')) {
+        n.fraction = p + 1;
+        p = n.fraction_end = accumulate(p + 1, last, w);
+    }
+    const std::ptrdiff_t int_digits = n.integer_end - n.integer;
+    const std::ptrdiff_t frac_digits = n.fraction_end - n.fraction;
+    if (int_digits + frac_digits == 0) return first;
+
+    if (p != last && (*p == CharT('e') || *p == CharT('E'))) {
+        const CharT* e = p + 1;
+        bool negative = false;
+        if (e != last && (*e == CharT('-') || *e == CharT('+'))) {
+            negative = *e == CharT('-');
+            ++e;
+        }
+        if (e != last && is_digit(*e)) {
+            std::int64_t x = 0;
+            for (; e != last && is_digit(*e); ++e) {
+                // Past any exponent that matters; the digits are still consumed
+                if (x < 0x10000000) x = x * 10 + (*e - CharT('0'));
+            }
+            n.exponent = negative ? -x : x;
+            p = e;
+        }
+    }
+
+    n.w = w;
+    n.q = n.exponent - frac_digits;
+    if (int_digits + frac_digits > 19) {
+        // Leading zeros do not count; past 19 significant digits, keep the
+        // first 19 and note that the rest were dropped
+        const CharT* s = n.integer;
+        while (s != n.integer_end && *s == CharT('0')) ++s;
+        std::ptrdiff_t significant = n.integer_end - s + frac_digits;
+        if (s == n.integer_end) {
+            const CharT* f = n.fraction;
+            while (f != n.fraction_end && *f == CharT('0')) ++f;
+            significant = n.fraction_end - f;
+        }
+        if (significant > 19) {
+            n.truncated = true;
+            w = 0;
+            for (s = n.integer; w < min_19_digits && s != n.integer_end; ++s) {
+                w = w * 10 + static_cast<std::uint64_t>(*s - CharT('0'));
+            }
+            if (w >= min_19_digits) {
+                n.q = n.exponent + (n.integer_end - s);
+            } else {
+                for (s = n.fraction; w < min_19_digits && s != n.fraction_end; ++s) {
+                    w = w * 10 + static_cast<std::uint64_t>(*s - CharT('0'));
+                }
+                n.q = n.exponent - (s - n.fraction);
+            }
+            n.w = w;
+        }
+    }
+    return p;
+}
+
+// ==================== Fast Paths ====================
+
+// Powers of ten a binary_t holds exactly: 5^22 < 2^53, 5^10 < 2^24
+template <typename F>
+inline constexpr F exact_pow10[] = {
+    F(1e0), F(1e1), F(1e2), F(1e3), F(1e4), F(1e5), F(1e6), F(1e7), F(1e8), F(1e9), F(1e10),
+    F(1e11), F(1e12), F(1e13), F(1e14), F(1e15), F(1e16), F(1e17), F(1e18), F(1e19), F(1e20),
+    F(1e21), F(1e22),
+};
+
+// A multiply or divide rounds once only if it is done in the type itself
+// (or one at least twice as wide); x87 arithmetic in long double is not
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD != 0 && FLT_EVAL_METHOD != 1
+inline constexpr bool exact_arithmetic = false;
+#else
+inline constexpr bool exact_arithmetic = true;
+#endif
+
+/**
+ * @brief w * 10^q when w and 10^q are both exact in F (Clinger): the one
+ *        operation is correctly rounded
+ */
+template <std::floating_point F>
+constexpr bool clinger(std::uint64_t w, std::int64_t q, F& value) noexcept {
+    using B = floating::ieee<F>;
+    constexpr std::int64_t max_q = B::significand_bits == 52 ? 22 : 10;
+    if (!exact_arithmetic && !std::is_constant_evaluated()) return false;
+    if (w > (std::uint64_t{1} << (B::significand_bits + 1)) || q < -max_q || q > max_q) return false;
+    value = q < 0 ? static_cast<F>(w) / exact_pow10<F>[-q] : static_cast<F>(w) * exact_pow10<F>[q];
+    return true;
+}
+
+/**
+ * @brief The bits of w * 10^q rounded to F, for w != 0 and q in
+ *        [min_exponent, 308] (Eisel-Lemire)
+ *
+ * The top 64 bits of w times the 128-bit power of ten hold the rounded
+ * significand unless the truncated low half could still carry into them,
+ * or the product sits exactly on a halfway point the truncation may have
+ * hidden. Both are detected and reported as failure, as are results that
+ * would be subnormal or infinite.
+ */
+template <std::floating_point F>
+constexpr bool eisel_lemire(std::uint64_t w, int q, std::uint64_t& bits) noexcept {
+    using B = floating::ieee<F>;
+    constexpr int p = B::significand_bits;
+    constexpr int shift = 64 - p - 3;
+    constexpr std::uint64_t mask = (std::uint64_t{1} << shift) - 1;
+    constexpr int bias = (1 << (B::exponent_bits - 1)) - 1;
+    constexpr int max_field = (1 << B::exponent_bits) - 1;
+
+    const int lz = std::countl_zero(w);
+    w <<= lz;
+    // floor(q * log2(10)) + 64 + bias - lz: the biased exponent of the product
+    int e2 = ((217706 * q) >> 16) + 64 + bias - lz;
+
+    const pow10::entry g = pow10::table[q - pow10::min_exponent];
+    floating::uint128 x = floating::umul128(w, g.hi);
+    if ((x.hi & mask) == mask && x.lo + w < w) {
+        // The low half of the power may carry into the bits that matter
+        const floating::uint128 y = floating::umul128(w, g.lo);
+        floating::uint128 merged{x.hi, x.lo + y.hi};
+        if (merged.lo < x.lo) ++merged.hi;
+        if ((merged.hi & mask) == mask && merged.lo + 1 == 0 && y.lo + w < w) return false;
+        x = merged;
+    }
+
+    const int msb = static_cast<int>(x.hi >> 63);
+    std::uint64_t m = x.hi >> (msb + shift);
+    e2 -= 1 ^ msb;
+    if (x.lo == 0 && (x.hi & mask) == 0 && (m & 3) == 1) return false;
+
+    m += m & 1;
+    m >>= 1;
+    if (m >> (p + 1)) {
+        m >>= 1;
+        ++e2;
+    }
+    if (e2 <= 0 || e2 >= max_field) return false;
+    bits = (static_cast<std::uint64_t>(e2) << p) | (m & ((std::uint64_t{1} << p) - 1));
+    return true;
+}
+
+// ==================== Exact Fallback ====================
+
+/**
+ * @brief A decimal 0.d[0]d[1]... * 10^dp of up to 800 digits
+ *
+ * Multiplying or dividing by a power of two (at most 60 at a time) is
+ * schoolbook arithmetic on the digits. Scaling until the value is in
+ * [2^p, 2^(p+1)) leaves the significand in the integer part and the
+ * rounding in the digits after it. Digits pushed out past 800 are only
+ * remembered as `truncated`, which is enough to break a tie.
+ */
+struct decimal {
+    static constexpr int capacity = 800;
+    static constexpr unsigned max_shift = 60;
+
+    unsigned char d[capacity] = {};
+    int nd = 0;
+    std::int64_t dp = 0;
+    bool truncated = false;
+
+    constexpr void push(unsigned digit) noexcept {
+        if (nd < capacity) {
+            d[nd++] = static_cast<unsigned char>(digit);
+        } else if (digit != 0) {
+            truncated = true;
+        }
+    }
+
+    constexpr void trim() noexcept {
+        while (nd > 0 && d[nd - 1] == 0) --nd;
+        if (nd == 0) dp = 0;
+    }
+
+    // *= 2^k, k in [1, 60]: from the last digit up, into a scratch that
+    // has room for the digits the carry adds in front
+    constexpr void shift_left(unsigned k) noexcept {
+        unsigned char out[capacity + 20];
+        int w = capacity + 20;
+        std::uint64_t n = 0;
+        for (int r = nd - 1; r >= 0; --r) {
+            n += std::uint64_t{d[r]} << k;
+            out[--w] = static_cast<unsigned char>(n % 10);
+            n /= 10;
+        }
+        for (; n > 0; n /= 10) out[--w] = static_cast<unsigned char>(n % 10);
+
+        const int produced = capacity + 20 - w;
+        const int kept = produced < capacity ? produced : capacity;
+        for (int i = 0; i < kept; ++i) d[i] = out[w + i];
+        for (int i = kept; i < produced; ++i) truncated |= out[w + i] != 0;
+        dp += produced - nd;
+        nd = kept;
+        trim();
+    }
+
+    // /= 2^k, k in [1, 60]: long division from the first digit down
+    constexpr void shift_right(unsigned k) noexcept {
+        int r = 0;
+        int w = 0;
+        std::uint64_t n = 0;
+        for (; (n >> k) == 0; ++r) {
+            if (r >= nd) {
+                if (n == 0) {
+                    nd = 0;
+                    return;
+                }
+                for (; (n >> k) == 0; ++r) n *= 10;
+                break;
+            }
+            n = n * 10 + d[r];
+        }
+        dp -= r - 1;
+
+        const std::uint64_t mask = (std::uint64_t{1} << k) - 1;
+        for (; r < nd; ++r) {
+            const unsigned c = d[r];
+            d[w++] = static_cast<unsigned char>(n >> k);
+            n = (n & mask) * 10 + c;
+        }
+        for (; n > 0; n = (n & mask) * 10) {
+            const unsigned digit = static_cast<unsigned>(n >> k);
+            if (w < capacity) {
+                d[w++] = static_cast<unsigned char>(digit);
+            } else if (digit != 0) {
+                truncated = true;
+            }
+        }
+        nd = w;
+        trim();
+    }
+
+    constexpr void shift(int k) noexcept {
+        if (nd == 0) return;
+        for (; k > static_cast<int>(max_shift); k -= max_shift) shift_left(max_shift);
+        for (; k < -static_cast<int>(max_shift); k += max_shift) shift_right(max_shift);
+        if (k > 0) shift_left(static_cast<unsigned>(k));
+        if (k < 0) shift_right(static_cast<unsigned>(-k));
+    }
+
+    // Digit `i` and beyond round the integer part up: above half, or
+    // exactly half (nothing after it, nothing truncated) and odd
+    constexpr bool round_up(std::int64_t i) const noexcept {
+        if (i < 0 || i >= nd) return false;
+        if (d[i] == 5 && i + 1 == nd) {
+            return truncated || (i > 0 && d[i - 1] % 2 == 1);
+        }
+        return d[i] >= 5;
+    }
+
+    constexpr std::uint64_t rounded_integer() const noexcept {
+        if (dp > 20) return ~std::uint64_t{0};
+        std::uint64_t n = 0;
+        std::int64_t i = 0;
+        for (; i < dp && i < nd; ++i) n = n * 10 + d[i];
+        for (; i < dp; ++i) n *= 10;
+        return n + round_up(dp);
+    }
+
+    /**
+     * @brief The bits of the value rounded to F; `overflow` is set (and
+     *        the bits are infinity's) when it rounds past the largest
+     */
+    template <std::floating_point F>
+    constexpr std::uint64_t to_binary(bool& overflow) noexcept {
+        using B = floating::ieee<F>;
+        constexpr int p = B::significand_bits;
+        constexpr int bias = (1 << (B::exponent_bits - 1)) - 1;
+        constexpr int max_field = (1 << B::exponent_bits) - 1;
+        // Shifts that keep the leading digit of 10^dp-scaled values put
+        constexpr int steps[] = {1, 3, 6, 9, 13, 16, 19, 23, 26};
+        constexpr std::uint64_t infinity = std::uint64_t{max_field} << p;
+
+        overflow = false;
+        if (nd == 0) return 0;
+        if (dp > 310) {
+            overflow = true;
+            return infinity;
+        }
+        if (dp < -330) return 0;
+
+        // Into [1/2, 1), counting the binary exponent
+        int e = 0;
+        while (dp > 0) {
+            const int n = dp >= 9 ? 27 : steps[dp];
+            shift(-n);
+            e += n;
+        }
+        while (dp < 0 || (dp == 0 && d[0] < 5)) {
+            const int n = -dp >= 9 ? 27 : steps[-dp];
+            shift(n);
+            e -= n;
+        }
+        --e;  // [1, 2) is the binary significand's range
+
+        if (e < 1 - bias) {
+            // Subnormal: fewer significand bits
+            const int n = 1 - bias - e;
+            shift(-n);
+            e += n;
+        }
+        if (e + bias >= max_field) {
+            overflow = true;
+            return infinity;
+        }
+
+        shift(p + 1);
+        std::uint64_t m = rounded_integer();
+        if (m == std::uint64_t{2} << p) {
+            m >>= 1;
+            if (++e + bias >= max_field) {
+                overflow = true;
+                return infinity;
+            }
+        }
+        if ((m & (std::uint64_t{1} << p)) == 0) e = -bias;
+        return (static_cast<std::uint64_t>(e + bias) << p) | (m & ((std::uint64_t{1} << p) - 1));
+    }
+};
+
+// All the digits of `n`, leading zeros dropped
+template <meta::character CharT>
+constexpr void fill(decimal& d, const number<CharT>& n) noexcept {
+    const CharT* s = n.integer;
+    while (s != n.integer_end && *s == CharT('0')) ++s;
+    for (; s != n.integer_end; ++s) {
+        d.push(static_cast<unsigned>(*s - CharT('0')));
+        ++d.dp;
+    }
+    s = n.fraction;
+    if (d.nd == 0) {
+        for (; s != n.fraction_end && *s == CharT('0'); ++s) --d.dp;
+    }
+    for (; s != n.fraction_end; ++s) d.push(static_cast<unsigned>(*s - CharT('0')));
+    d.dp += n.exponent;
+    d.trim();
+}
+
+// ==================== Conversion ====================
+
+template <std::floating_point F>
+constexpr F from_bits(std::uint64_t bits) noexcept {
+    return std::bit_cast<F>(static_cast<typename floating::ieee<F>::bits_type>(bits));
+}
+
+/**
+ * @brief The finite value `n` spells, rounded to F; `range` is set when
+ *        nonzero digits round to zero or the value rounds to infinity
+ */
+template <std::floating_point F, meta::character CharT>
+constexpr F convert(const number<CharT>& n, bool& range) noexcept {
+    range = false;
+    if (n.w == 0) return F(0);
+    if (n.q < pow10::min_exponent) {
+        range = true;
+        return F(0);
+    }
+    if (n.q > 308) {
+        range = true;
+        return std::numeric_limits<F>::infinity();
+    }
+
+    F value{};
+    if (!n.truncated && clinger(n.w, n.q, value)) return value;
+
+    std::uint64_t bits = 0;
+    if (eisel_lemire<F>(n.w, static_cast<int>(n.q), bits)) {
+        // Dropped digits put the value between w and w + 1: fine if both
+        // round the same way
+        std::uint64_t above = 0;
+        if (!n.truncated || (eisel_lemire<F>(n.w + 1, static_cast<int>(n.q), above) && above == bits)) {
+            return from_bits<F>(bits);
+        }
+    }
+
+    decimal d;
+    fill(d, n);
+    bool overflow = false;
+    bits = d.to_binary<F>(overflow);
+    range = overflow || bits == 0;
+    return from_bits<F>(bits);
+}
+
+/**
+ * @brief Read a floating-point number from [first, last)
+ *
+ * Returns the end of the match. On a match, `value` is the correctly
+ * rounded value and `ec` is std::errc{}, or result_out_of_range with
+ * `value` the zero or infinity it rounded to. Without one, `first` is
+ * returned, `ec` is invalid_argument and `value` is untouched. long
+ * double is read as a double.
+ */
+template <std::floating_point T, meta::character CharT>
+constexpr const CharT* read(const CharT* first, const CharT* last, T& value, std::errc& ec) noexcept {
+    using F = floating::binary_t<T>;
+    number<CharT> n;
+    const CharT* end = scan(first, last, n);
+    if (end == first) {
+        ec = std::errc::invalid_argument;
+        return first;
+    }
+
+    F result{};
+    bool range = false;
+    switch (n.kind) {
+        case floating::category::nan: result = std::numeric_limits<F>::quiet_NaN(); break;
+        case floating::category::infinity: result = std::numeric_limits<F>::infinity(); break;
+        default: result = convert<F>(n, range); break;
+    }
+    value = static_cast<T>(n.negative ? -result : result);
+    ec = range ? std::errc::result_out_of_range : std::errc{};
+    return end;
+}
+
+// ==================== Integers ====================
+
+/**
+ * @brief The magnitude of the digits of `Base` from `p` into `m`;
+ *        returns their end, with `overflow` set past 2^64 - 1
+ *
+ * Digits are read without a check per digit: the count of significant
+ * digits decides overflow afterwards. Base 10 holds any 19 digits, so
+ * only a 20-digit run needs its last step checked. A power-of-two base
+ * overflows when the digits hold more than 64 bits.
+ */
+template <unsigned Base, meta::character CharT>
+constexpr const CharT* read_magnitude(const CharT* p, const CharT* last, std::uint64_t& m, bool& overflow) noexcept {
+    constexpr int bits = std::countr_zero(Base);
+    constexpr std::ptrdiff_t safe = Base == 10 ? 19 : 64 / bits;
+    const CharT* s = p;
+    m = 0;
+    p = accumulate<Base>(p, last, m);
+    std::ptrdiff_t n = p - s;
+    if (n <= safe) return p;
+
+    // Leading zeros hold no value: only the significant digits count
+    for (; s != p && *s == CharT('0'); ++s) --n;
+    if constexpr (Base == 10) {
+        if (n == 20) {
+            std::uint64_t head = 0;
+            accumulate<10>(s, s + 19, head);
+            const auto d = static_cast<std::uint64_t>(s[19] - CharT('0'));
+            overflow = head > (~std::uint64_t{0} - d) / 10;
+        } else {
+            overflow = n > 20;
+        }
+    } else {
+        overflow = n > 0 && (n - 1) * bits + std::bit_width(digit_value(*s)) > 64;
+    }
+    return p;
+}
+
+// Any other base: one checked step per digit
+template <meta::character CharT>
+constexpr const CharT* read_magnitude(const CharT* p, const CharT* last, unsigned base,
+                                      std::uint64_t& m, bool& overflow) noexcept {
+    const std::uint64_t limit = ~std::uint64_t{0} / base;
+    m = 0;
+    for (unsigned d; p != last && (d = digit_value(*p)) < base; ++p) {
+        if (m > limit || m * base > ~std::uint64_t{0} - d) overflow = true;
+        m = m * base + d;
+    }
+    return p;
+}
+
+/**
+ * @brief Read an integer in `base` (2 to 36) from [first, last)
+ *
+ * Accepts [+|-] digits ('+' being an extension over std::from_chars),
+ * '-' only for signed T; letters of either case
+ * are digits from 10 up. Returns the end of the match. On a match `ec`
+ * is std::errc{} and `value` is set, or `ec` is result_out_of_range when
+ * the value does not fit T, which leaves `value` untouched. Without one,
+ * `first` is returned and `ec` is invalid_argument.
+ */
+template <std::integral T, meta::character CharT>
+constexpr const CharT* read(const CharT* first, const CharT* last, T& value, int base, std::errc& ec) noexcept {
+    const CharT* p = first;
+    bool negative = false;
+    if (p != last && (*p == CharT('-') || *p == CharT('+'))) {
+        negative = *p == CharT('-');
+        ++p;
+    }
+    if (base < 2 || base > 36 || p == last || digit_value(*p) >= static_cast<unsigned>(base) ||
+        (negative && !std::is_signed_v<T>)) {
+        ec = std::errc::invalid_argument;
+        return first;
+    }
+
+    std::uint64_t m = 0;
+    bool overflow = false;
+    switch (base) {
+        case 10: p = read_magnitude<10>(p, last, m, overflow); break;
+        case 16: p = read_magnitude<16>(p, last, m, overflow); break;
+        case 2: p = read_magnitude<2>(p, last, m, overflow); break;
+        case 8: p = read_magnitude<8>(p, last, m, overflow); break;
+        default: p = read_magnitude(p, last, static_cast<unsigned>(base), m, overflow); break;
+    }
+
+    using U = std::make_unsigned_t<T>;
+    const std::uint64_t max = static_cast<U>(std::numeric_limits<T>::max());
+    if (overflow || m > max + negative) {
+        ec = std::errc::result_out_of_range;
+        return p;
+    }
+    value = static_cast<T>(negative ? static_cast<U>(U(0) - static_cast<U>(m)) : static_cast<U>(m));
+    ec = std::errc{};
+    return p;
+}
+
+} // namespace zuu::detail::parsing
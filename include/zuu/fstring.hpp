@@ -65,18 +65,37 @@ namespace zuu {
 
 // Core storage
 #include "core/core.hpp"
+#include "core/hash.hpp"
 #include "core/literals.hpp"
 
 // String algorithms (pipeable)
 #include "str/pipe.hpp"
+#include "str/fuse.hpp"
+#include "str/charset.hpp"
 #include "str/trim.hpp"
 #include "str/case.hpp"
+#include "str/icase.hpp"
+#include "str/unicode_case.hpp"
+#include "str/transform.hpp"
 #include "str/split.hpp"
+#include "str/split_view.hpp"
+#include "str/concat.hpp"
 #include "str/find.hpp"
+#include "str/searcher.hpp"
+#include "str/multi_matcher.hpp"
 
 // Formatting system
 #include "fmt/core.hpp"
 
+// Containers
+#include "container/fstring_map.hpp"
+#include "container/intern_pool.hpp"
+
+// I/O
+#include "io/file.hpp"
+#include "io/line_reader.hpp"
+#include "io/csv.hpp"
+
 // ==================== Convenience Namespace ====================
 
 namespace zuu {
@@ -148,6 +167,8 @@ namespace types {
  * auto s2 = to_fstring(hex(255));      // "0xff"
  * auto s3 = to_fstring(bin(5));        // "0b101"
  * auto s4 = to_fstring(pad_left(7, 3)); // "007"
+ * auto s5 = to_fstring(0.1);          // "0.1"
+ * auto s6 = to_fstring(fixed(0.5, 2)); // "0.50"
  * @endcode
  * 
  * @section sec_constexpr Compile-Time Operations
@@ -0,0 +1,383 @@
+#pragma once
+
+/**
+ * @file zuu/io/csv.hpp
+ * @brief RFC 4180 CSV/TSV reader with a SIMD structural-mask stage
+ * @version 3.0.0
+ *
+ * Design Philosophy:
+ * - Stage 1 classifies 64 bytes at a time: quote and separator bitmasks
+ *   from compare + movemask, then prefix_xor of the quote mask gives the
+ *   bytes inside quotes, so quoted delimiters and newlines drop out with
+ *   one AND-NOT (the simdcsv scheme)
+ * - Stage 2 walks the surviving bits to cut fields; quoted fields are
+ *   unquoted and "" collapsed in place inside the reader's buffer
+ * - Fields are string_views into that buffer, valid until the next read;
+ *   row::into copies them into fstring columns when they must persist
+ * - No column limit; records may span buffer refills
+ *
+ * Records end at '\n' (a preceding '\r' is dropped) and blank lines are
+ * skipped. Quote characters are expected only around quoted fields, as
+ * RFC 4180 requires; a stray quote inside an unquoted field opens a
+ * quoted section.
+ *
+ * Usage:
+ *   csv::reader in{"trades.csv"};
+ *   fstring<16> symbol; fstring<32> venue; std::string_view price;
+ *   in.for_each([&](const csv::row& r) {
+ *       r.into(symbol, venue, price);
+ *   });
+ *
+ *   csv::batch rows;
+ *   while (in.next_batch(rows, 4096)) { for (auto r : rows.rows()) { ... } }
+ */
+
+#include "../core/core.hpp"
+#include "../core/simd.hpp"
+#include "file.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace zuu::csv {
+
+// ==================== Dialect ====================
+
+struct dialect {
+    char delimiter = ',';
+    char quote = '"';
+};
+
+inline constexpr dialect rfc4180{};
+inline constexpr dialect tsv{'\t', '"'};
+
+// ==================== Row ====================
+
+/**
+ * @brief Fields of one record; a view into reader or batch storage
+ */
+class row {
+    const std::string_view* fields_ = nullptr;
+    std::size_t size_ = 0;
+
+    template <typename Column>
+    void assign(Column& column, std::size_t i) const {
+        column = i < size_ ? Column(fields_[i]) : Column{};
+    }
+
+public:
+    using value_type = std::string_view;
+    using size_type = std::size_t;
+
+    constexpr row() noexcept = default;
+    constexpr row(const std::string_view* fields, size_type size) noexcept
+        : fields_{fields}, size_{size} {}
+
+    [[nodiscard]] constexpr size_type size() const noexcept { return size_; }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+
+    [[nodiscard]] constexpr std::string_view operator[](size_type i) const noexcept { return fields_[i]; }
+
+    [[nodiscard]] constexpr const std::string_view* begin() const noexcept { return fields_; }
+    [[nodiscard]] constexpr const std::string_view* end() const noexcept { return fields_ + size_; }
+
+    /**
+     * @brief Assign fields to `columns` in order; returns how many existed
+     *
+     * Columns may be basic_fstring<char, N> (truncating copy),
+     * std::string_view or anything constructible from one. Columns past
+     * the last field are cleared.
+     */
+    template <typename... Columns>
+    size_type into(Columns&... columns) const {
+        size_type i = 0;
+        (assign(columns, i++), ...);
+        return std::min(size_, sizeof...(Columns));
+    }
+
+    template <std::size_t N>
+    size_type into(std::span<basic_fstring<char, N>> columns) const {
+        for (size_type i = 0; i < columns.size(); ++i) assign(columns[i], i);
+        return std::min(size_, columns.size());
+    }
+};
+
+// ==================== Batch ====================
+
+/**
+ * @brief Rows filled by reader::next_batch; valid until the next read
+ */
+class batch {
+    std::vector<std::string_view> fields_;
+    std::vector<std::size_t> ends_;     // one past each row's last field
+
+    friend class reader;
+
+public:
+    using size_type = std::size_t;
+
+    [[nodiscard]] size_type size() const noexcept { return ends_.size(); }
+    [[nodiscard]] bool empty() const noexcept { return ends_.empty(); }
+
+    [[nodiscard]] row operator[](size_type i) const noexcept {
+        const size_type first = i == 0 ? 0 : ends_[i - 1];
+        return row{fields_.data() + first, ends_[i] - first};
+    }
+
+    [[nodiscard]] auto rows() const {
+        return std::views::iota(size_type{0}, size()) |
+               std::views::transform([this](size_type i) { return (*this)[i]; });
+    }
+
+    void clear() noexcept {
+        fields_.clear();
+        ends_.clear();
+    }
+};
+
+// ==================== Reader ====================
+
+class reader {
+public:
+    using size_type = std::size_t;
+
+private:
+    enum class step { record, refill, end };
+
+    io::input_file file_;
+    std::string_view memory_;           // memory source: bytes not yet buffered
+
+    std::unique_ptr<char[]> buffer_;
+    size_type capacity_ = 0;
+    size_type size_ = 0;
+
+    size_type record_start_ = 0;        // first byte of the record being cut
+    size_type field_start_ = 0;
+    size_type scan_ = 0;                // next byte to classify
+    size_type block_base_ = 0;          // offset of bit 0 of mask_
+    std::uint64_t mask_ = 0;            // unvisited separators in the current block
+    std::uint64_t in_quote_ = 0;        // all-ones while quoting spans blocks
+    bool eof_ = false;
+    bool record_done_ = false;
+
+    dialect dialect_;
+    std::vector<std::string_view> fields_;
+    std::uint64_t rows_ = 0;
+
+    reader(dialect d, size_type buffer_size)
+        : buffer_{std::make_unique_for_overwrite<char[]>(std::max<size_type>(buffer_size, 64))},
+          capacity_{std::max<size_type>(buffer_size, 64)},
+          dialect_{d} {}
+
+    // ---------- Stage 1: structural bitmasks ----------
+
+    void classify() noexcept {
+        const char* p = buffer_.get() + scan_;
+        const size_type len = std::min<size_type>(64, size_ - scan_);
+        std::uint64_t quotes = 0;
+        std::uint64_t seps = 0;
+
+#if defined(ZUU_SIMD_SSE2)
+        if (len == 64) {
+            quotes = detail::simd::block_mask64(detail::simd::unit_matcher<char>{dialect_.quote}, p);
+            seps = detail::simd::block_mask64(detail::simd::pair_matcher<char>{dialect_.delimiter, '\n'}, p);
+        } else
+#endif
+        {
+            for (size_type i = 0; i < len; ++i) {
+                quotes |= std::uint64_t{p[i] == dialect_.quote} << i;
+                seps |= std::uint64_t{p[i] == dialect_.delimiter || p[i] == '\n'} << i;
+            }
+        }
+
+        // Bits above a short block carry the final state, so bit 63 is the carry
+        const std::uint64_t inside = detail::simd::prefix_xor(quotes) ^ in_quote_;
+        in_quote_ = std::uint64_t{0} - (inside >> 63);
+
+        mask_ = seps & ~inside;
+        block_base_ = scan_;
+        scan_ += len;
+    }
+
+    // Keep the unfinished record and rescan it from its first byte, where
+    // quoting is always closed
+    void refill() {
+        const size_type tail = size_ - record_start_;
+        if (record_start_ != 0) std::memmove(buffer_.get(), buffer_.get() + record_start_, tail);
+        size_ = tail;
+        record_start_ = field_start_ = scan_ = block_base_ = 0;
+        mask_ = in_quote_ = 0;
+        fields_.clear();
+
+        if (size_ == capacity_) {
+            auto grown = std::make_unique_for_overwrite<char[]>(capacity_ * 2);
+            std::memcpy(grown.get(), buffer_.get(), size_);
+            buffer_ = std::move(grown);
+            capacity_ *= 2;
+        }
+
+        size_type got = 0;
+        if (file_.is_open()) {
+            got = file_.read(buffer_.get() + size_, capacity_ - size_);
+        } else {
+            got = std::min(memory_.size(), capacity_ - size_);
+            std::memcpy(buffer_.get() + size_, memory_.data(), got);
+            memory_.remove_prefix(got);
+        }
+        size_ += got;
+        eof_ = got == 0;
+    }
+
+    // ---------- Stage 2: fields ----------
+
+    // Strip the surrounding quotes and collapse "" in place
+    std::string_view unquote(std::string_view raw) noexcept {
+        const char q = dialect_.quote;
+        const size_type close = raw.size() >= 2 && raw.back() == q ? raw.size() - 1 : raw.size();
+        char* first = buffer_.get() + (raw.data() - buffer_.get()) + 1;
+        const size_type len = close - 1;
+
+        const size_type hit = detail::simd::find_char(first, len, q);
+        if (hit == len) return {first, len};
+
+        char* out = first + hit;
+        for (size_type i = hit; i < len; ++i) {
+            *out++ = first[i];
+            if (first[i] == q && i + 1 < len && first[i + 1] == q) ++i;
+        }
+        return {first, static_cast<size_type>(out - first)};
+    }
+
+    void finish_record() noexcept {
+        std::string_view& last = fields_.back();
+        if (!last.empty() && last.back() == '\r') last.remove_suffix(1);
+
+        for (auto& f : fields_) {
+            if (!f.empty() && f.front() == dialect_.quote) f = unquote(f);
+        }
+        record_done_ = true;
+        ++rows_;
+    }
+
+    step scan_record(bool may_refill) {
+        if (record_done_) {
+            fields_.clear();
+            record_done_ = false;
+        }
+
+        for (;;) {
+            while (mask_ == 0) {
+                if (scan_ == size_) {
+                    if (!eof_) {
+                        if (!may_refill) return step::refill;
+                        refill();
+                        continue;
+                    }
+                    // Last record without a trailing newline
+                    if (record_start_ == size_) return step::end;
+                    fields_.emplace_back(buffer_.get() + field_start_, size_ - field_start_);
+                    record_start_ = field_start_ = size_;
+                    if (fields_.size() == 1 && (fields_[0].empty() || fields_[0] == "\r")) {
+                        fields_.clear();
+                        return step::end;
+                    }
+                    finish_record();
+                    return step::record;
+                }
+                classify();
+            }
+
+            const size_type p = block_base_ + static_cast<size_type>(std::countr_zero(mask_));
+            mask_ &= mask_ - 1;
+
+            fields_.emplace_back(buffer_.get() + field_start_, p - field_start_);
+            field_start_ = p + 1;
+
+            if (buffer_[p] == '\n') {
+                record_start_ = field_start_;
+                if (fields_.size() == 1 && (fields_[0].empty() || fields_[0] == "\r")) {
+                    fields_.clear();
+                    continue;
+                }
+                finish_record();
+                return step::record;
+            }
+        }
+    }
+
+public:
+    // ==================== Construction ====================
+
+    /**
+     * @brief Read `path`; throws std::system_error if it cannot be opened
+     */
+    explicit reader(const char* path, dialect d = {}, size_type buffer_size = size_type{1} << 20)
+        : reader{d, buffer_size} {
+        file_ = io::input_file{path};
+        file_.advise_sequential();
+    }
+
+    // Parse a caller-owned buffer (copied through the reader's buffer in chunks)
+    [[nodiscard]] static reader from_memory(
+        std::string_view text, dialect d = {}, size_type buffer_size = size_type{1} << 20
+    ) {
+        reader r{d, buffer_size};
+        r.memory_ = text;
+        return r;
+    }
+
+    reader(reader&&) noexcept = default;
+    reader& operator=(reader&&) noexcept = default;
+
+    // ==================== Reading ====================
+
+    /**
+     * @brief Next record; false at end of input
+     */
+    bool next(row& r) {
+        if (scan_record(true) != step::record) return false;
+        r = row{fields_.data(), fields_.size()};
+        return true;
+    }
+
+    /**
+     * @brief Up to `max_rows` records from the current buffer into `out`
+     *
+     * Refills only when no complete record is buffered, so every row of
+     * the batch stays valid together. Returns the number of rows; 0 at
+     * end of input.
+     */
+    size_type next_batch(batch& out, size_type max_rows = 1024) {
+        out.clear();
+        while (out.size() < max_rows) {
+            if (scan_record(out.empty()) != step::record) break;
+            out.fields_.insert(out.fields_.end(), fields_.begin(), fields_.end());
+            out.ends_.push_back(out.fields_.size());
+        }
+        return out.size();
+    }
+
+    /**
+     * @brief Call `fn(const row&)` for every remaining record; returns the count
+     */
+    template <typename Fn>
+    std::uint64_t for_each(Fn&& fn) {
+        const std::uint64_t before = rows_;
+        row r;
+        while (next(r)) fn(std::as_const(r));
+        return rows_ - before;
+    }
+
+    // Records returned so far
+    [[nodiscard]] std::uint64_t rows_read() const noexcept { return rows_; }
+};
+
+} // namespace zuu::csv
@@ -0,0 +1,129 @@
+#pragma once
+
+/**
+ * @file zuu/io/file.hpp
+ * @brief Minimal read-only file handle shared by the io readers
+ * @version 3.0.0
+ *
+ * POSIX descriptors where available (so readers can also mmap), stdio
+ * elsewhere. Errors surface as std::system_error.
+ */
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <system_error>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define ZUU_IO_POSIX 1
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace zuu::io {
+
+// ==================== Input File ====================
+
+class input_file {
+public:
+    using size_type = std::size_t;
+
+private:
+#if defined(ZUU_IO_POSIX)
+    int fd_ = -1;
+#else
+    std::FILE* file_ = nullptr;
+#endif
+
+public:
+    input_file() noexcept = default;
+
+    // Throws std::system_error if `path` cannot be opened
+    explicit input_file(const char* path) {
+#if defined(ZUU_IO_POSIX)
+        fd_ = ::open(path, O_RDONLY | O_CLOEXEC);
+        if (fd_ < 0) throw std::system_error(errno, std::generic_category(), path);
+#else
+        file_ = std::fopen(path, "rb");
+        if (file_ == nullptr) throw std::system_error(errno, std::generic_category(), path);
+#endif
+    }
+
+#if defined(ZUU_IO_POSIX)
+    input_file(input_file&& other) noexcept : fd_{std::exchange(other.fd_, -1)} {}
+
+    input_file& operator=(input_file&& other) noexcept {
+        if (this != &other) {
+            close();
+            fd_ = std::exchange(other.fd_, -1);
+        }
+        return *this;
+    }
+
+    [[nodiscard]] bool is_open() const noexcept { return fd_ >= 0; }
+    [[nodiscard]] int native_handle() const noexcept { return fd_; }
+
+    void close() noexcept {
+        if (fd_ >= 0) ::close(std::exchange(fd_, -1));
+    }
+#else
+    input_file(input_file&& other) noexcept : file_{std::exchange(other.file_, nullptr)} {}
+
+    input_file& operator=(input_file&& other) noexcept {
+        if (this != &other) {
+            close();
+            file_ = std::exchange(other.file_, nullptr);
+        }
+        return *this;
+    }
+
+    [[nodiscard]] bool is_open() const noexcept { return file_ != nullptr; }
+
+    void close() noexcept {
+        if (file_ != nullptr) std::fclose(std::exchange(file_, nullptr));
+    }
+#endif
+
+    input_file(const input_file&) = delete;
+    input_file& operator=(const input_file&) = delete;
+
+    ~input_file() { close(); }
+
+    /**
+     * @brief Read up to `n` bytes into `dst`; 0 at end of file
+     */
+    size_type read(char* dst, size_type n) {
+#if defined(ZUU_IO_POSIX)
+        for (;;) {
+            const ::ssize_t got = ::read(fd_, dst, n);
+            if (got >= 0) return static_cast<size_type>(got);
+            if (errno != EINTR) throw std::system_error(errno, std::generic_category(), "read");
+        }
+#else
+        const size_type got = std::fread(dst, 1, n, file_);
+        if (got == 0 && std::ferror(file_)) throw std::system_error(EIO, std::generic_category(), "read");
+        return got;
+#endif
+    }
+
+    // Size of a regular file; 0 for pipes, devices and unknown sizes
+    [[nodiscard]] size_type regular_size() const noexcept {
+#if defined(ZUU_IO_POSIX)
+        struct ::stat st {};
+        if (::fstat(fd_, &st) == 0 && S_ISREG(st.st_mode)) return static_cast<size_type>(st.st_size);
+#endif
+        return 0;
+    }
+
+    // Hint that the file will be read front to back
+    void advise_sequential() noexcept {
+#if defined(ZUU_IO_POSIX) && defined(POSIX_FADV_SEQUENTIAL)
+        ::posix_fadvise(fd_, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+    }
+};
+
+} // namespace zuu::io
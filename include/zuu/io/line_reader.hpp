@@ -0,0 +1,319 @@
+#pragma once
+
+/**
+ * @file zuu/io/line_reader.hpp
+ * @brief Streaming line reader over files, memory maps and buffers
+ * @version 3.0.0
+ *
+ * Design Philosophy:
+ * - Lines are string_views into the reader's window; nothing is copied
+ *   per line and a view stays valid until the next read
+ * - Buffered mode read()s into one reusable, page-aligned buffer; only the
+ *   unfinished tail of a chunk is moved to the front before the next read
+ * - Mapped mode maps the whole file, so every line points into the map
+ * - '\n' ends a line and one trailing '\r' is dropped; unlike split_lines,
+ *   empty lines are yielded so line numbers stay exact
+ *
+ * Usage:
+ *   io::line_reader in{"access.log"};
+ *   for (std::string_view line : in) {
+ *       auto fields = line | trim | split_lazy(' ');
+ *   }
+ *
+ *   fstring<128> rec;
+ *   while (in.next(rec, io::overflow_policy::skip)) { auto key = rec | to_lower; }
+ */
+
+#include "../core/core.hpp"
+#include "../core/simd.hpp"
+#include "file.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+namespace zuu::io {
+
+// ==================== Options ====================
+
+/**
+ * @brief What next(basic_fstring&) does with a line longer than Cap
+ */
+enum class overflow_policy {
+    truncate,   // keep the first Cap characters
+    skip,       // drop the line and read the next one
+    split,      // yield the line in consecutive pieces of at most Cap
+    error       // throw std::length_error
+};
+
+enum class read_mode {
+    automatic,  // mapped for regular files of at least mmap_threshold bytes
+    buffered,
+    mapped      // falls back to buffered where mmap is unavailable
+};
+
+struct reader_options {
+    std::size_t buffer_size = std::size_t{1} << 20;
+    read_mode mode = read_mode::automatic;
+    std::size_t mmap_threshold = std::size_t{64} << 20;
+};
+
+// ==================== Line Reader ====================
+
+class line_reader {
+public:
+    using size_type = std::size_t;
+
+private:
+    static constexpr std::align_val_t buffer_align{4096};
+
+    input_file file_;
+#if defined(ZUU_IO_POSIX)
+    void* map_ = nullptr;
+    size_type map_size_ = 0;
+#endif
+
+    char* buffer_ = nullptr;        // buffered mode only
+    size_type capacity_ = 0;
+
+    const char* data_ = nullptr;    // current window
+    size_type size_ = 0;
+    size_type pos_ = 0;             // start of the next line
+    size_type scanned_ = 0;         // no '\n' in [pos_, scanned_)
+    bool eof_ = true;
+
+    std::string_view pending_;      // rest of a line being split by overflow_policy::split
+    std::uint64_t line_number_ = 0;
+
+    line_reader() = default;
+
+    void release() noexcept {
+#if defined(ZUU_IO_POSIX)
+        if (map_ != nullptr) ::munmap(map_, map_size_);
+#endif
+        if (buffer_ != nullptr) ::operator delete(buffer_, buffer_align);
+    }
+
+    void allocate(size_type capacity) {
+        char* grown = static_cast<char*>(::operator new(capacity, buffer_align));
+        if (buffer_ != nullptr) {
+            std::memcpy(grown, buffer_, size_);
+            ::operator delete(buffer_, buffer_align);
+        }
+        buffer_ = grown;
+        capacity_ = capacity;
+        data_ = buffer_;
+    }
+
+    // Move the unfinished line to the front, grow if it fills the buffer, read more
+    void refill() {
+        const size_type tail = size_ - pos_;
+        if (pos_ != 0) {
+            std::memmove(buffer_, buffer_ + pos_, tail);
+            scanned_ -= pos_;
+            size_ = tail;
+            pos_ = 0;
+        }
+        if (size_ == capacity_) allocate(capacity_ * 2);
+
+        const size_type got = file_.read(buffer_ + size_, capacity_ - size_);
+        size_ += got;
+        eof_ = got == 0;
+    }
+
+    void open(const char* path, const reader_options& options) {
+        file_ = input_file{path};
+
+#if defined(ZUU_IO_POSIX)
+        const size_type file_size = file_.regular_size();
+        const bool map = file_size != 0 &&
+            (options.mode == read_mode::mapped ||
+             (options.mode == read_mode::automatic && file_size >= options.mmap_threshold));
+
+        if (map) {
+            void* p = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file_.native_handle(), 0);
+            if (p != MAP_FAILED) {
+                ::madvise(p, file_size, MADV_SEQUENTIAL);
+                map_ = p;
+                map_size_ = file_size;
+                data_ = static_cast<const char*>(p);
+                size_ = file_size;
+                eof_ = true;
+                return;
+            }
+        }
+#endif
+        file_.advise_sequential();
+        allocate(options.buffer_size < 64 ? 64 : options.buffer_size);
+        eof_ = false;
+    }
+
+public:
+    // ==================== Construction ====================
+
+    /**
+     * @brief Open `path`; throws std::system_error if it cannot be opened
+     */
+    explicit line_reader(const char* path, const reader_options& options = {}) {
+        try {
+            open(path, options);
+        } catch (...) {
+            release();
+            throw;
+        }
+    }
+
+    // Lines of an in-memory buffer, which must outlive the reader
+    [[nodiscard]] static line_reader from_memory(std::string_view text) noexcept {
+        line_reader r;
+        r.data_ = text.data();
+        r.size_ = text.size();
+        return r;
+    }
+
+    line_reader(line_reader&& other) noexcept { *this = std::move(other); }
+
+    line_reader& operator=(line_reader&& other) noexcept {
+        if (this != &other) {
+            release();
+            file_ = std::move(other.file_);
+#if defined(ZUU_IO_POSIX)
+            map_ = std::exchange(other.map_, nullptr);
+            map_size_ = std::exchange(other.map_size_, 0);
+#endif
+            buffer_ = std::exchange(other.buffer_, nullptr);
+            capacity_ = std::exchange(other.capacity_, 0);
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            pos_ = std::exchange(other.pos_, 0);
+            scanned_ = std::exchange(other.scanned_, 0);
+            eof_ = std::exchange(other.eof_, true);
+            pending_ = std::exchange(other.pending_, {});
+            line_number_ = std::exchange(other.line_number_, 0);
+        }
+        return *this;
+    }
+
+    line_reader(const line_reader&) = delete;
+    line_reader& operator=(const line_reader&) = delete;
+
+    ~line_reader() { release(); }
+
+    // ==================== Reading ====================
+
+    /**
+     * @brief Next line without its terminator; false at end of input
+     *
+     * `line` stays valid until the next call on this reader.
+     */
+    bool next(std::string_view& line) {
+        for (;;) {
+            const size_type from = scanned_ > pos_ ? scanned_ : pos_;
+            const size_type idx = from + detail::simd::find_char(data_ + from, size_ - from, '\n');
+
+            size_type end;
+            if (idx < size_) {
+                end = idx;
+            } else if (!eof_) {
+                scanned_ = size_;
+                refill();
+                continue;
+            } else if (pos_ < size_) {
+                end = size_;
+            } else {
+                return false;
+            }
+
+            size_type len = end - pos_;
+            if (len != 0 && data_[pos_ + len - 1] == '\r') --len;
+            line = std::string_view{data_ + pos_, len};
+
+            pos_ = end < size_ ? end + 1 : end;
+            scanned_ = pos_;
+            ++line_number_;
+            return true;
+        }
+    }
+
+    /**
+     * @brief Next line copied into `line`, applying `policy` when it
+     *        exceeds Cap; false at end of input
+     */
+    template <std::size_t Cap>
+    bool next(basic_fstring<char, Cap>& line, overflow_policy policy = overflow_policy::truncate) {
+        std::string_view text;
+        if (!pending_.empty()) {
+            text = pending_;
+            pending_ = {};
+        } else if (!next(text)) {
+            return false;
+        }
+
+        while (text.size() > Cap) {
+            if (policy == overflow_policy::truncate) {
+                text = text.substr(0, Cap);
+            } else if (policy == overflow_policy::split) {
+                pending_ = text.substr(Cap);
+                text = text.substr(0, Cap);
+            } else if (policy == overflow_policy::error) {
+                throw std::length_error("line_reader: line exceeds capacity");
+            } else if (!next(text)) {
+                return false;
+            }
+        }
+
+        line = basic_fstring<char, Cap>{text.data(), text.size()};
+        return true;
+    }
+
+    // 1-based number of the line last returned
+    [[nodiscard]] std::uint64_t line_number() const noexcept { return line_number_; }
+
+    [[nodiscard]] bool mapped() const noexcept {
+#if defined(ZUU_IO_POSIX)
+        return map_ != nullptr;
+#else
+        return false;
+#endif
+    }
+
+    // ==================== Range Interface ====================
+
+    /**
+     * @brief Single-pass iterator: for (std::string_view line : reader)
+     */
+    class iterator {
+        line_reader* reader_ = nullptr;
+        std::string_view line_;
+
+    public:
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = std::input_iterator_tag;
+
+        iterator() noexcept = default;
+        explicit iterator(line_reader& reader) : reader_{&reader} { ++*this; }
+
+        [[nodiscard]] std::string_view operator*() const noexcept { return line_; }
+
+        iterator& operator++() {
+            if (!reader_->next(line_)) reader_ = nullptr;
+            return *this;
+        }
+
+        void operator++(int) { ++*this; }
+
+        [[nodiscard]] friend bool operator==(const iterator& it, std::default_sentinel_t) noexcept {
+            return it.reader_ == nullptr;
+        }
+    };
+
+    [[nodiscard]] iterator begin() { return iterator{*this}; }
+    [[nodiscard]] std::default_sentinel_t end() const noexcept { return {}; }
+};
+
+} // namespace zuu::io
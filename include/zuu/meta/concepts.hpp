@@ -39,11 +39,11 @@ concept convertible_to_string_view = requires(T t) {
     { std::basic_string_view{t} } -> std::same_as<std::basic_string_view<typename T::value_type>>;
 };
 
-// Main StringLike concept
+// Main StringLike concept (references and cv-qualified types included)
 template <typename T>
 concept string_like = 
-    has_data_and_size<T> || 
-    convertible_to_string_view<T>;
+    has_data_and_size<std::remove_cvref_t<T>> || 
+    convertible_to_string_view<std::remove_cvref_t<T>>;
 
 // ==================== Fixed-Capacity String Detection ====================
 
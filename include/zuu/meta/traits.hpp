@@ -7,7 +7,9 @@
  */
 
 #include "concepts.hpp"
+#include <cstdint>
 #include <span>
+#include <type_traits>
 
 namespace zuu::meta {
 
@@ -110,6 +112,15 @@ struct expand_capacity {
     }();
 };
 
+// ==================== Storage Helpers ====================
+
+// Smallest unsigned integer able to hold values in [0, N]
+template <std::size_t N>
+using uint_for_t =
+    std::conditional_t<(N <= 0xFF), std::uint8_t,
+    std::conditional_t<(N <= 0xFFFF), std::uint16_t,
+    std::conditional_t<(N <= 0xFFFFFFFF), std::uint32_t, std::uint64_t>>>;
+
 // ==================== SFINAE Helpers ====================
 
 // Check if type is trivially copyable (optimization hint)
@@ -8,29 +8,59 @@
  * Usage:
  *   auto result = to_upper(str);
  *   auto result = str | to_lower | reverse;  // Composable!
+ *
+ * The conversions are element-wise stages (fuse.hpp): composed with each
+ * other or with trim, they share one loop. Each writes its result with
+ * one size update; rvalue inputs are converted in their own storage, and
+ * the *_inplace forms (or `s |= to_lower`) rewrite an lvalue.
+ *
+ * At runtime to_lower, to_upper and toggle_case run alone through vector
+ * kernels (simd.hpp, 16/32 bytes of any code unit width per step), as
+ * do equals_ignore_case and mismatch_ignore_case; constant evaluation
+ * keeps the scalar loops. Search, ordering and hashing that ignore case
+ * are in icase.hpp.
  */
 
 #include "../core/core.hpp"
+#include "../core/simd.hpp"
+#include "fuse.hpp"
 #include "pipe.hpp"
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 
 namespace zuu::str {
 
 // ==================== Helpers ====================
 
+// Branch-free (one unsigned range test) so loops over mixed-case text
+// neither mispredict nor stop vectorizing
 template <meta::character CharT>
 constexpr CharT char_to_lower(CharT ch) noexcept {
-    if (ch >= CharT('A') && ch <= CharT('Z')) {
-        return ch + (CharT('a') - CharT('A'));
-    }
-    return ch;
+    const unsigned upper = static_cast<unsigned>(ch) - unsigned('A') < 26u;
+    return static_cast<CharT>(ch + upper * (CharT('a') - CharT('A')));
 }
 
 template <meta::character CharT>
 constexpr CharT char_to_upper(CharT ch) noexcept {
-    if (ch >= CharT('a') && ch <= CharT('z')) {
-        return ch - (CharT('a') - CharT('A'));
+    const unsigned lower = static_cast<unsigned>(ch) - unsigned('a') < 26u;
+    return static_cast<CharT>(ch - lower * (CharT('a') - CharT('A')));
+}
+
+/**
+ * @brief Index of the first unit where [a, a + count) and [b, b + count)
+ *        differ ignoring ASCII case, or `count`
+ */
+template <meta::character CharT>
+constexpr std::size_t mismatch_ignore_case(const CharT* a, const CharT* b, std::size_t count) noexcept {
+    if (!std::is_constant_evaluated()) {
+        return detail::simd::mismatch_ignore_case(a, b, count);
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        if (char_to_lower(a[i]) != char_to_lower(b[i])) return i;
     }
-    return ch;
+    return count;
 }
 
 template <meta::character CharT>
@@ -47,139 +77,77 @@ constexpr bool is_whitespace(CharT ch) noexcept {
 
 // ==================== To Lower ====================
 
-struct to_lower_fn : pipe_adaptor<to_lower_fn> {
-    template <meta::character CharT, std::size_t Cap>
-    constexpr auto apply(const basic_fstring<CharT, Cap>& str) const noexcept {
-        basic_fstring<CharT, Cap> result;
-        
-        for (std::size_t i = 0; i < str.size(); ++i) {
-            result.push_back(char_to_lower(str[i]));
-        }
-        
-        return result;
-    }
+struct to_lower_fn : fusable_adaptor<to_lower_fn> {
+    template <meta::character CharT>
+    static constexpr CharT map(CharT ch) noexcept { return char_to_lower(ch); }
 
-    // Generic string_view version
     template <meta::character CharT>
-    constexpr auto apply(std::basic_string_view<CharT> sv) const noexcept {
-        constexpr std::size_t default_cap = 256;
-        basic_fstring<CharT, default_cap> result;
-        
-        for (std::size_t i = 0; i < sv.size() && !result.full(); ++i) {
-            result.push_back(char_to_lower(sv[i]));
-        }
-        
-        return result;
+    static void map_n(const CharT* src, std::size_t n, CharT* dst) noexcept {
+        detail::simd::ascii_case_convert<detail::simd::ascii_case::lower>(src, n, dst);
     }
 };
 
 inline constexpr to_lower_fn to_lower;
+inline constexpr inplace_fn<to_lower_fn> to_lower_inplace;
 
 // ==================== To Upper ====================
 
-struct to_upper_fn : pipe_adaptor<to_upper_fn> {
-    template <meta::character CharT, std::size_t Cap>
-    constexpr auto apply(const basic_fstring<CharT, Cap>& str) const noexcept {
-        basic_fstring<CharT, Cap> result;
-        
-        for (std::size_t i = 0; i < str.size(); ++i) {
-            result.push_back(char_to_upper(str[i]));
-        }
-        
-        return result;
-    }
+struct to_upper_fn : fusable_adaptor<to_upper_fn> {
+    template <meta::character CharT>
+    static constexpr CharT map(CharT ch) noexcept { return char_to_upper(ch); }
 
     template <meta::character CharT>
-    constexpr auto apply(std::basic_string_view<CharT> sv) const noexcept {
-        constexpr std::size_t default_cap = 256;
-        basic_fstring<CharT, default_cap> result;
-        
-        for (std::size_t i = 0; i < sv.size() && !result.full(); ++i) {
-            result.push_back(char_to_upper(sv[i]));
-        }
-        
-        return result;
+    static void map_n(const CharT* src, std::size_t n, CharT* dst) noexcept {
+        detail::simd::ascii_case_convert<detail::simd::ascii_case::upper>(src, n, dst);
     }
 };
 
 inline constexpr to_upper_fn to_upper;
+inline constexpr inplace_fn<to_upper_fn> to_upper_inplace;
 
 // ==================== To Title Case ====================
 
-struct to_title_fn : pipe_adaptor<to_title_fn> {
-    template <meta::character CharT, std::size_t Cap>
-    constexpr auto apply(const basic_fstring<CharT, Cap>& str) const noexcept {
-        basic_fstring<CharT, Cap> result;
+struct to_title_fn : fusable_adaptor<to_title_fn> {
+    struct fuse_state {
         bool capitalize_next = true;
-        
-        for (std::size_t i = 0; i < str.size(); ++i) {
-            CharT ch = str[i];
-            
-            if (is_whitespace(ch)) {
-                capitalize_next = true;
-                result.push_back(ch);
-            } else if (is_alpha(ch)) {
-                result.push_back(capitalize_next ? char_to_upper(ch) : char_to_lower(ch));
-                capitalize_next = false;
-            } else {
-                result.push_back(ch);
-                capitalize_next = false;
-            }
-        }
-        
-        return result;
-    }
+    };
 
+    // Bitwise tests and selects, so a fused loop has no data-dependent branch
     template <meta::character CharT>
-    constexpr auto apply(std::basic_string_view<CharT> sv) const noexcept {
-        constexpr std::size_t default_cap = 256;
-        basic_fstring<CharT, default_cap> result;
-        bool capitalize_next = true;
-        
-        for (std::size_t i = 0; i < sv.size() && !result.full(); ++i) {
-            CharT ch = sv[i];
-            
-            if (is_whitespace(ch)) {
-                capitalize_next = true;
-                result.push_back(ch);
-            } else if (is_alpha(ch)) {
-                result.push_back(capitalize_next ? char_to_upper(ch) : char_to_lower(ch));
-                capitalize_next = false;
-            } else {
-                result.push_back(ch);
-                capitalize_next = false;
-            }
-        }
-        
-        return result;
+    static constexpr CharT step(fuse_state& state, CharT ch) noexcept {
+        // is_whitespace as a bit test: '\t', '\n', '\r' and ' ' in a 64-bit set
+        const auto u = static_cast<std::make_unsigned_t<CharT>>(ch);
+        const bool space = (u < 64u) & static_cast<bool>((0x100002600ull >> (u & 63u)) & 1u);
+        const unsigned capitalize = std::exchange(state.capitalize_next, space);
+
+        const auto lower = static_cast<CharT>(ch | CharT(0x20));
+        const unsigned alpha = static_cast<unsigned>(lower) - unsigned('a') < 26u;
+        const auto cased = static_cast<CharT>(lower ^ (capitalize << 5));
+        return static_cast<CharT>(ch ^ ((ch ^ cased) * alpha));
     }
 };
 
 inline constexpr to_title_fn to_title;
+inline constexpr inplace_fn<to_title_fn> to_title_inplace;
 
 // ==================== Toggle Case ====================
 
-struct toggle_case_fn : pipe_adaptor<toggle_case_fn> {
-    template <meta::character CharT, std::size_t Cap>
-    constexpr auto apply(const basic_fstring<CharT, Cap>& str) const noexcept {
-        basic_fstring<CharT, Cap> result;
-        
-        for (std::size_t i = 0; i < str.size(); ++i) {
-            CharT ch = str[i];
-            if (ch >= CharT('a') && ch <= CharT('z')) {
-                result.push_back(char_to_upper(ch));
-            } else if (ch >= CharT('A') && ch <= CharT('Z')) {
-                result.push_back(char_to_lower(ch));
-            } else {
-                result.push_back(ch);
-            }
-        }
-        
-        return result;
+struct toggle_case_fn : fusable_adaptor<toggle_case_fn> {
+    // ASCII letters differ from their other case only in bit 0x20
+    template <meta::character CharT>
+    static constexpr CharT map(CharT ch) noexcept {
+        const unsigned alpha = static_cast<unsigned>(ch | CharT(0x20)) - unsigned('a') < 26u;
+        return static_cast<CharT>(ch ^ (alpha << 5));
+    }
+
+    template <meta::character CharT>
+    static void map_n(const CharT* src, std::size_t n, CharT* dst) noexcept {
+        detail::simd::ascii_case_convert<detail::simd::ascii_case::toggle>(src, n, dst);
     }
 };
 
 inline constexpr toggle_case_fn toggle_case;
+inline constexpr inplace_fn<toggle_case_fn> toggle_case_inplace;
 
 // ==================== Case-Insensitive Comparison ====================
 
@@ -189,15 +157,16 @@ struct equals_ignore_case_fn {
         const basic_fstring<CharT, Cap1>& lhs,
         const basic_fstring<CharT, Cap2>& rhs
     ) const noexcept {
-        if (lhs.size() != rhs.size()) return false;
-        
-        for (std::size_t i = 0; i < lhs.size(); ++i) {
-            if (char_to_lower(lhs[i]) != char_to_lower(rhs[i])) {
-                return false;
-            }
-        }
-        
-        return true;
+        return (*this)(lhs, std::basic_string_view<CharT>{rhs});
+    }
+
+    template <meta::character CharT, std::size_t Cap>
+    constexpr bool operator()(
+        const basic_fstring<CharT, Cap>& lhs,
+        std::type_identity_t<std::basic_string_view<CharT>> rhs
+    ) const noexcept {
+        return lhs.size() == rhs.size() &&
+               mismatch_ignore_case(lhs.data(), rhs.data(), lhs.size()) == lhs.size();
     }
 };
 
@@ -0,0 +1,226 @@
+#pragma once
+
+/**
+ * @file zuu/str/charset.hpp
+ * @brief Compiled character sets for O(n) class scans
+ * @version 3.0.0
+ *
+ * Usage:
+ *   static constexpr str::charset delims{" ,;:\t"};     // built at compile time
+ *   auto pos   = line | find_first_of(delims);
+ *   auto parts = line | split(delims);
+ *   auto core  = line | trim_if(str::charset{"-_ "});
+ */
+
+#include "../core/core.hpp"
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace zuu::str {
+
+// ==================== Charset ====================
+
+/**
+ * @brief Set of code units compiled into a bitmap and shuffle tables
+ *
+ * Code units below 0x100 live in a 256-bit bitmap, mirrored into the two
+ * 16-entry nibble tables consumed by the SSSE3/AVX2 byte classifier in
+ * simd.hpp, so `char` scans run 16/32 units per step. Wider code units
+ * above 0xFF are kept in a short list of `wide_capacity` entries; members
+ * past that are dropped and reported by `overflowed()`.
+ */
+template <meta::character CharT>
+class charset {
+public:
+    using value_type = CharT;
+    using size_type = std::size_t;
+
+    static constexpr size_type npos = static_cast<size_type>(-1);
+    static constexpr size_type wide_capacity = sizeof(CharT) == 1 ? 0 : 32;
+
+private:
+    using unit = std::make_unsigned_t<CharT>;
+
+    std::uint64_t bits_[4]{};
+    std::uint8_t low_[16]{};       // bytes 0x00-0x7F, see simd::class_member
+    std::uint8_t high_[16]{};      // bytes 0x80-0xFF
+    CharT wide_[wide_capacity == 0 ? 1 : wide_capacity]{};
+    size_type wide_size_ = 0;
+    bool overflowed_ = false;
+
+    static constexpr bool use_simd() noexcept {
+        return sizeof(CharT) == 1 && !std::is_constant_evaluated();
+    }
+
+    template <bool Member>
+    constexpr size_type scan_forward(std::basic_string_view<CharT> str, size_type pos) const noexcept {
+        const size_type n = str.size();
+        if (pos >= n) return npos;
+
+        if constexpr (sizeof(CharT) == 1) {
+            if (use_simd()) {
+                const size_type idx = detail::simd::find_class<Member>(
+                    str.data() + pos, n - pos, low_, high_);
+                return idx == n - pos ? npos : pos + idx;
+            }
+        }
+        for (size_type i = pos; i < n; ++i) {
+            if (contains(str[i]) == Member) return i;
+        }
+        return npos;
+    }
+
+    template <bool Member>
+    constexpr size_type scan_backward(std::basic_string_view<CharT> str, size_type pos) const noexcept {
+        if (str.empty()) return npos;
+        const size_type count = pos < str.size() ? pos + 1 : str.size();
+
+        if constexpr (sizeof(CharT) == 1) {
+            if (use_simd()) {
+                const size_type idx = detail::simd::rfind_class<Member>(
+                    str.data(), count, low_, high_);
+                return idx == count ? npos : idx;
+            }
+        }
+        for (size_type i = count; i > 0; --i) {
+            if (contains(str[i - 1]) == Member) return i - 1;
+        }
+        return npos;
+    }
+
+public:
+    // ==================== Construction ====================
+
+    constexpr charset() noexcept = default;
+
+    constexpr charset(std::basic_string_view<CharT> chars) noexcept {
+        for (CharT ch : chars) insert(ch);
+    }
+
+    template <size_type M>
+    constexpr charset(const CharT (&chars)[M]) noexcept
+        : charset{std::basic_string_view<CharT>{chars}} {}
+
+    template <size_type Cap>
+    constexpr charset(const basic_fstring<CharT, Cap>& chars) noexcept
+        : charset{std::basic_string_view<CharT>{chars}} {}
+
+    constexpr charset& insert(CharT ch) noexcept {
+        const auto u = static_cast<unit>(ch);
+        if (u < 0x100) {
+            bits_[u >> 6] |= std::uint64_t{1} << (u & 63);
+            auto& row = (u & 0x80) ? high_[u & 0x0F] : low_[u & 0x0F];
+            row = static_cast<std::uint8_t>(row | (1u << ((u >> 4) & 7)));
+        } else if constexpr (wide_capacity != 0) {
+            if (contains(ch)) return *this;
+            if (wide_size_ < wide_capacity) {
+                wide_[wide_size_++] = ch;
+            } else {
+                overflowed_ = true;
+            }
+        }
+        return *this;
+    }
+
+    // ==================== Observers ====================
+
+    [[nodiscard]] constexpr bool contains(CharT ch) const noexcept {
+        const auto u = static_cast<unit>(ch);
+        if (u < 0x100) return (bits_[u >> 6] >> (u & 63)) & 1;
+
+        for (size_type i = 0; i < wide_size_; ++i) {
+            if (wide_[i] == ch) return true;
+        }
+        return false;
+    }
+
+    [[nodiscard]] constexpr bool operator()(CharT ch) const noexcept {
+        return contains(ch);
+    }
+
+    // True when wide members were dropped; membership is then incomplete
+    [[nodiscard]] constexpr bool overflowed() const noexcept { return overflowed_; }
+
+    // ==================== Scans ====================
+
+    [[nodiscard]] constexpr size_type find_first_of(
+        std::basic_string_view<CharT> str, size_type pos = 0
+    ) const noexcept {
+        return scan_forward<true>(str, pos);
+    }
+
+    [[nodiscard]] constexpr size_type find_first_not_of(
+        std::basic_string_view<CharT> str, size_type pos = 0
+    ) const noexcept {
+        return scan_forward<false>(str, pos);
+    }
+
+    // Last member at or before `pos`
+    [[nodiscard]] constexpr size_type find_last_of(
+        std::basic_string_view<CharT> str, size_type pos = npos
+    ) const noexcept {
+        return scan_backward<true>(str, pos);
+    }
+
+    [[nodiscard]] constexpr size_type find_last_not_of(
+        std::basic_string_view<CharT> str, size_type pos = npos
+    ) const noexcept {
+        return scan_backward<false>(str, pos);
+    }
+
+    [[nodiscard]] constexpr bool contains_any(std::basic_string_view<CharT> str) const noexcept {
+        return find_first_of(str) != npos;
+    }
+};
+
+// ==================== Deduction Guides ====================
+
+template <meta::character CharT, std::size_t M>
+charset(const CharT (&)[M]) -> charset<CharT>;
+
+template <meta::character CharT, std::size_t Cap>
+charset(const basic_fstring<CharT, Cap>&) -> charset<CharT>;
+
+template <meta::character CharT>
+charset(std::basic_string_view<CharT>) -> charset<CharT>;
+
+// ==================== One-Shot Scans ====================
+
+enum class set_scan { first_of, first_not_of, last_of, last_not_of };
+
+/**
+ * @brief Compile `chars` once and scan `str` with it
+ *
+ * Backs the overloads taking a plain string as the set. A set with more
+ * wide members than a charset holds falls back to string_view's scan.
+ */
+template <set_scan Kind, meta::character CharT>
+constexpr std::size_t scan_set(
+    std::basic_string_view<CharT> str,
+    std::basic_string_view<CharT> chars
+) noexcept {
+    const charset<CharT> set{chars};
+
+    if (!set.overflowed()) {
+        if constexpr (Kind == set_scan::first_of) return set.find_first_of(str);
+        else if constexpr (Kind == set_scan::first_not_of) return set.find_first_not_of(str);
+        else if constexpr (Kind == set_scan::last_of) return set.find_last_of(str);
+        else return set.find_last_not_of(str);
+    }
+
+    if constexpr (Kind == set_scan::first_of) return str.find_first_of(chars);
+    else if constexpr (Kind == set_scan::first_not_of) return str.find_first_not_of(chars);
+    else if constexpr (Kind == set_scan::last_of) return str.find_last_of(chars);
+    else return str.find_last_not_of(chars);
+}
+
+// ==================== Detection ====================
+
+template <typename T>
+inline constexpr bool is_charset_v = false;
+
+template <meta::character CharT>
+inline constexpr bool is_charset_v<charset<CharT>> = true;
+
+} // namespace zuu::str
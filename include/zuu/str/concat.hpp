@@ -0,0 +1,223 @@
+#pragma once
+
+/**
+ * @file zuu/str/concat.hpp
+ * @brief Exact-size concatenation and joining into fstrings or buffers
+ * @version 3.0.0
+ *
+ * Design Philosophy:
+ * - Lengths are summed up front; every piece is copied exactly once
+ *   (char_traits::copy, i.e. memcpy at runtime) and the size is set once
+ * - Pieces are any mix of fstrings, literals, string_views, std::strings,
+ *   C strings and single characters
+ * - Writers follow snprintf: they write what fits and return the length
+ *   the full result needs, so `n > room` reports truncation
+ *
+ * Usage:
+ *   auto path = concat(dir, '/', name, ".txt"_fs);     // fstring<sum of capacities>
+ *   fstring<128> line;
+ *   concat_into(line, key, " = ", value_view);          // appends
+ *   join_into(line, parts | split_lazy(','), "; ");     // any range of string-likes
+ *   char buf[64];
+ *   auto n = concat_into(std::span{buf}, a, b);         // caller buffer
+ */
+
+#include "../core/core.hpp"
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace zuu::str {
+
+// ==================== Pieces ====================
+
+template <typename T>
+using piece_char_t = std::conditional_t<
+    meta::character<std::remove_cvref_t<T>>,
+    std::remove_cvref_t<T>,
+    meta::char_type_of_t<std::decay_t<T>>>;
+
+/**
+ * @brief Compile-time upper bound on a piece's length, 0 when unknown
+ */
+template <typename T>
+inline constexpr std::size_t piece_capacity = 0;
+
+template <meta::character CharT>
+inline constexpr std::size_t piece_capacity<CharT> = 1;
+
+template <meta::character CharT, std::size_t N>
+inline constexpr std::size_t piece_capacity<CharT[N]> = N - 1;
+
+template <meta::character CharT, std::size_t Cap>
+inline constexpr std::size_t piece_capacity<basic_fstring<CharT, Cap>> = Cap;
+
+template <typename T>
+inline constexpr bool has_piece_capacity = piece_capacity<std::remove_cvref_t<T>> != 0;
+
+template <meta::character CharT, typename T>
+[[nodiscard]] constexpr std::basic_string_view<CharT> piece_view(const T& piece) noexcept {
+    if constexpr (std::is_same_v<T, CharT>) {
+        return {&piece, 1};
+    } else {
+        return std::basic_string_view<CharT>(piece);
+    }
+}
+
+// Copy as much of `src` as fits in [dst, dst + room); returns units copied
+template <meta::character CharT>
+constexpr std::size_t copy_piece(CharT* dst, std::size_t room, std::basic_string_view<CharT> src) noexcept {
+    const std::size_t n = src.size() < room ? src.size() : room;
+    std::char_traits<CharT>::copy(dst, src.data(), n);
+    return n;
+}
+
+// ==================== Output Targets ====================
+
+template <typename CharT, typename T>
+inline constexpr bool is_std_string = false;
+
+template <typename CharT, typename Traits, typename Alloc>
+inline constexpr bool is_std_string<CharT, std::basic_string<CharT, Traits, Alloc>> = true;
+
+/**
+ * @brief Let `fill(dst, room)` write `total` units after the current end
+ *        of `out`; returns `total`
+ *
+ * `out` is a basic_fstring (append, clamped to capacity), a
+ * std::basic_string (append, grown to fit) or anything convertible to
+ * std::span<CharT> (written from the front, no terminator).
+ */
+template <meta::character CharT, typename Out, typename Fill>
+constexpr std::size_t write_into(Out& out, std::size_t total, Fill fill) {
+    if constexpr (meta::fixed_string<Out>) {
+        const std::size_t start = out.size();
+        out.resize_and_overwrite(start + total, [&](CharT* p, std::size_t n) {
+            return start + fill(p + start, n - start);
+        });
+    } else if constexpr (is_std_string<CharT, Out>) {
+        const std::size_t start = out.size();
+        out.resize(start + total);
+        fill(out.data() + start, total);
+    } else if constexpr (std::is_convertible_v<Out&, std::span<CharT>>) {
+        const std::span<CharT> buf = out;
+        fill(buf.data(), buf.size());
+    } else {
+        static_assert(!sizeof(Out), "concat/join target must be an fstring, std::basic_string or span");
+    }
+    return total;
+}
+
+// ==================== Concat ====================
+
+struct concat_fn {
+    /**
+     * @brief Concatenate pieces with compile-time capacities into
+     *        basic_fstring<CharT, sum of capacities>
+     */
+    template <typename First, typename... Rest>
+    requires has_piece_capacity<First> && (has_piece_capacity<Rest> && ...)
+    [[nodiscard]] constexpr auto operator()(const First& first, const Rest&... rest) const noexcept {
+        using CharT = piece_char_t<First>;
+        constexpr std::size_t cap = piece_capacity<std::remove_cvref_t<First>> +
+                                    (piece_capacity<std::remove_cvref_t<Rest>> + ... + 0);
+        basic_fstring<CharT, cap> result;
+        concat_into_impl<CharT>(result, first, rest...);
+        return result;
+    }
+
+    template <meta::character CharT, typename Out, typename... Pieces>
+    static constexpr std::size_t concat_into_impl(Out& out, const Pieces&... pieces) {
+        const std::basic_string_view<CharT> views[] = {piece_view<CharT>(pieces)...};
+        std::size_t total = 0;
+        for (const auto& v : views) total += v.size();
+
+        return write_into<CharT>(out, total, [&](CharT* dst, std::size_t room) {
+            std::size_t written = 0;
+            for (const auto& v : views) written += copy_piece(dst + written, room - written, v);
+            return written;
+        });
+    }
+};
+
+inline constexpr concat_fn concat;
+
+struct concat_into_fn {
+    /**
+     * @brief Append pieces to `out`; returns the length they needed
+     */
+    template <typename Out, typename First, typename... Rest>
+    constexpr std::size_t operator()(Out&& out, const First& first, const Rest&... rest) const {
+        return concat_fn::concat_into_impl<piece_char_t<First>>(out, first, rest...);
+    }
+};
+
+inline constexpr concat_into_fn concat_into;
+
+// ==================== Join ====================
+
+struct join_into_fn {
+    /**
+     * @brief Append the elements of `parts` separated by `delimiter`;
+     *        returns the length the result needed
+     *
+     * Forward ranges are measured first so each element is copied once;
+     * single-pass ranges append as they go (into a span, each piece
+     * lands after the previous one).
+     */
+    template <typename Out, std::ranges::input_range R, typename Delim>
+    constexpr std::size_t operator()(Out&& out, R&& parts, const Delim& delimiter) const {
+        using CharT = piece_char_t<Delim>;
+        const std::basic_string_view<CharT> delim = piece_view<CharT>(delimiter);
+
+        if constexpr (std::ranges::forward_range<R>) {
+            std::size_t total = 0;
+            std::size_t count = 0;
+            for (const auto& part : parts) {
+                total += piece_view<CharT>(part).size();
+                ++count;
+            }
+            if (count > 1) total += (count - 1) * delim.size();
+
+            return write_into<CharT>(out, total, [&](CharT* dst, std::size_t room) {
+                std::size_t written = 0;
+                bool first = true;
+                for (const auto& part : parts) {
+                    if (!first) written += copy_piece(dst + written, room - written, delim);
+                    written += copy_piece(dst + written, room - written, piece_view<CharT>(part));
+                    first = false;
+                }
+                return written;
+            });
+        } else {
+            // fstrings and std::strings append by themselves; span targets
+            // are written from the front, so each piece goes after the last
+            using Target = std::remove_cvref_t<Out>;
+            std::size_t total = 0;
+            auto put = [&](std::basic_string_view<CharT> piece) {
+                if constexpr (meta::fixed_string<Target> || is_std_string<CharT, Target>) {
+                    total += concat_fn::concat_into_impl<CharT>(out, piece);
+                } else {
+                    const std::span<CharT> buf = out;
+                    std::span<CharT> rest = buf.subspan(total < buf.size() ? total : buf.size());
+                    total += concat_fn::concat_into_impl<CharT>(rest, piece);
+                }
+            };
+
+            bool first = true;
+            for (const auto& part : parts) {
+                if (!first) put(delim);
+                put(piece_view<CharT>(part));
+                first = false;
+            }
+            return total;
+        }
+    }
+};
+
+inline constexpr join_into_fn join_into;
+
+} // namespace zuu::str
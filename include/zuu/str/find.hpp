@@ -9,10 +9,15 @@
  *   bool has = contains(str, 'x');
  *   bool has = str | contains('x');
  *   bool starts = starts_with(str, "prefix");
+ *   bool hit = str | contains(precompiled_searcher);
+ *   auto pos = str | find_first_of(str::charset{" ,;"});
  */
 
 #include "../core/core.hpp"
+#include "charset.hpp"
+#include "multi_matcher.hpp"
 #include "pipe.hpp"
+#include "searcher.hpp"
 
 namespace zuu::str {
 
@@ -52,7 +57,7 @@ struct contains_str_fn {
         const basic_fstring<CharT, Cap1>& str,
         const basic_fstring<CharT, Cap2>& substr
     ) const noexcept {
-        return str.find(substr.data()) != basic_fstring<CharT, Cap1>::npos;
+        return str.find(std::basic_string_view<CharT>{substr}) != basic_fstring<CharT, Cap1>::npos;
     }
     
     // Factory for piping
@@ -99,6 +104,15 @@ struct contains_fn {
         return contains_str_fn{}(str, substr);
     }
     
+    // Precompiled pattern overload
+    template <meta::character CharT, std::size_t Cap, precompiled_pattern Pattern>
+    [[nodiscard]] constexpr bool operator()(
+        const basic_fstring<CharT, Cap>& str,
+        const Pattern& pattern
+    ) const noexcept {
+        return pattern.contains(str);
+    }
+    
     // Factory for piping (character)
     template <meta::character CharT>
     [[nodiscard]] constexpr auto operator()(CharT ch) const noexcept {
@@ -109,12 +123,18 @@ struct contains_fn {
     
     // Factory for piping (string)
     template <typename T>
-    requires (!std::same_as<T, typename std::decay_t<T>::value_type>)
+    requires (!std::same_as<T, typename std::decay_t<T>::value_type> && !precompiled_pattern<T>)
     [[nodiscard]] constexpr auto operator()(T&& substr) const noexcept {
         return [substr = std::forward<T>(substr), this](const auto& str) {
             return (*this)(str, substr);
         };
     }
+    
+    // Factory for piping (precompiled pattern, borrowed when an lvalue)
+    template <precompiled_pattern Pattern>
+    [[nodiscard]] constexpr auto operator()(Pattern&& pattern) const noexcept {
+        return bind_pattern(*this, std::forward<Pattern>(pattern));
+    }
 };
 
 inline constexpr contains_fn contains;
@@ -244,7 +264,40 @@ struct find_fn {
         return str.find(substr, pos);
     }
     
+    template <meta::character CharT, std::size_t Cap>
+    [[nodiscard]] constexpr std::size_t operator()(
+        const basic_fstring<CharT, Cap>& str,
+        std::type_identity_t<std::basic_string_view<CharT>> substr,
+        std::size_t pos = 0
+    ) const noexcept {
+        return str.find(substr, pos);
+    }
+    
+    template <meta::character CharT, std::size_t Cap, std::size_t N>
+    [[nodiscard]] constexpr std::size_t operator()(
+        const basic_fstring<CharT, Cap>& str,
+        const searcher<CharT, N>& pattern,
+        std::size_t pos = 0
+    ) const noexcept {
+        const std::size_t found = pattern.find(str, pos);
+        return found == pattern.npos ? basic_fstring<CharT, Cap>::npos : found;
+    }
+    
+    // Start of the earliest-ending keyword match
+    template <meta::character CharT, std::size_t Cap, std::size_t S, std::size_t C, std::size_t P>
+    [[nodiscard]] constexpr std::size_t operator()(
+        const basic_fstring<CharT, Cap>& str,
+        const multi_matcher<CharT, S, C, P>& matcher
+    ) const noexcept {
+        return matcher.find_first(str).position;
+    }
+    
     // Factory for piping
+    template <precompiled_pattern Pattern>
+    [[nodiscard]] constexpr auto operator()(Pattern&& pattern) const noexcept {
+        return bind_pattern(*this, std::forward<Pattern>(pattern));
+    }
+    
     template <meta::character CharT>
     [[nodiscard]] constexpr auto operator()(CharT ch, std::size_t pos = 0) const noexcept {
         return [ch, pos, this](const auto& str) {
@@ -309,23 +362,25 @@ struct count_fn {
         const CharT* substr
     ) const noexcept {
         if (substr == nullptr) return 0;
-        
-        std::size_t substr_len = 0;
-        while (substr[substr_len] != CharT{}) ++substr_len;
-        
-        if (substr_len == 0) return 0;
-        
-        std::size_t cnt = 0;
-        std::size_t pos = 0;
-        
-        while (pos < str.size()) {
-            std::size_t found = str.find(substr, pos);
-            if (found == basic_fstring<CharT, Cap>::npos) break;
-            ++cnt;
-            pos = found + substr_len;
-        }
-        
-        return cnt;
+        return (*this)(str, std::basic_string_view<CharT>{substr});
+    }
+    
+    // Non-overlapping count; the needle is analysed once for the whole scan
+    template <meta::character CharT, std::size_t Cap>
+    [[nodiscard]] constexpr std::size_t operator()(
+        const basic_fstring<CharT, Cap>& str,
+        std::type_identity_t<std::basic_string_view<CharT>> substr
+    ) const noexcept {
+        const detail::substring_searcher<CharT> engine{substr.data(), substr.size()};
+        return engine.count(str.data(), str.size());
+    }
+    
+    template <meta::character CharT, std::size_t Cap, std::size_t N>
+    [[nodiscard]] constexpr std::size_t operator()(
+        const basic_fstring<CharT, Cap>& str,
+        const searcher<CharT, N>& pattern
+    ) const noexcept {
+        return pattern.count(str);
     }
     
     // Factory for piping
@@ -342,57 +397,68 @@ struct count_fn {
             return (*this)(str, substr);
         };
     }
+    
+    template <precompiled_pattern Pattern>
+    [[nodiscard]] constexpr auto operator()(Pattern&& pattern) const noexcept {
+        return bind_pattern(*this, std::forward<Pattern>(pattern));
+    }
 };
 
 inline constexpr count_fn count;
 
 // ==================== Find First Of (any character from set) ====================
 
+/*
+ * Character-set scans compile the set into a str::charset once per call
+ * (bitmap + shuffle tables), so every scan is O(n + k) rather than
+ * O(n * k). Pass a prebuilt charset to skip even that step in hot loops.
+ */
+
 struct find_first_of_fn {
+    template <meta::character CharT, std::size_t Cap>
+    [[nodiscard]] constexpr std::size_t operator()(
+        const basic_fstring<CharT, Cap>& str,
+        const charset<CharT>& set
+    ) const noexcept {
+        return set.find_first_of(str);
+    }
+    
     template <meta::character CharT, std::size_t Cap1, std::size_t Cap2>
     [[nodiscard]] constexpr std::size_t operator()(
         const basic_fstring<CharT, Cap1>& str,
-        const basic_fstring<CharT, Cap2>& charset
+        const basic_fstring<CharT, Cap2>& chars
     ) const noexcept {
-        for (std::size_t i = 0; i < str.size(); ++i) {
-            for (std::size_t j = 0; j < charset.size(); ++j) {
-                if (str[i] == charset[j]) {
-                    return i;
-                }
-            }
-        }
-        return basic_fstring<CharT, Cap1>::npos;
+        return scan_set<set_scan::first_of, CharT>(str, chars);
     }
     
     template <meta::character CharT, std::size_t Cap>
     [[nodiscard]] constexpr std::size_t operator()(
         const basic_fstring<CharT, Cap>& str,
-        const CharT* charset
+        const CharT* chars
     ) const noexcept {
-        if (charset == nullptr) return basic_fstring<CharT, Cap>::npos;
-        
-        for (std::size_t i = 0; i < str.size(); ++i) {
-            for (std::size_t j = 0; charset[j] != CharT{}; ++j) {
-                if (str[i] == charset[j]) {
-                    return i;
-                }
-            }
-        }
-        return basic_fstring<CharT, Cap>::npos;
+        if (chars == nullptr) return basic_fstring<CharT, Cap>::npos;
+        return scan_set<set_scan::first_of, CharT>(str, chars);
     }
     
     // Factory for piping
+    template <meta::character CharT>
+    [[nodiscard]] constexpr auto operator()(const charset<CharT>& set) const noexcept {
+        return [set, this](const auto& str) {
+            return (*this)(str, set);
+        };
+    }
+    
     template <meta::character CharT, std::size_t Cap>
-    [[nodiscard]] constexpr auto operator()(const basic_fstring<CharT, Cap>& charset) const noexcept {
-        return [charset, this](const auto& str) {
-            return (*this)(str, charset);
+    [[nodiscard]] constexpr auto operator()(const basic_fstring<CharT, Cap>& chars) const noexcept {
+        return [chars, this](const auto& str) {
+            return (*this)(str, chars);
         };
     }
     
     template <meta::character CharT>
-    [[nodiscard]] constexpr auto operator()(const CharT* charset) const noexcept {
-        return [charset, this](const auto& str) {
-            return (*this)(str, charset);
+    [[nodiscard]] constexpr auto operator()(const CharT* chars) const noexcept {
+        return [chars, this](const auto& str) {
+            return (*this)(str, chars);
         };
     }
 };
@@ -402,43 +468,50 @@ inline constexpr find_first_of_fn find_first_of;
 // ==================== Find Last Of ====================
 
 struct find_last_of_fn {
+    template <meta::character CharT, std::size_t Cap>
+    [[nodiscard]] constexpr std::size_t operator()(
+        const basic_fstring<CharT, Cap>& str,
+        const charset<CharT>& set
+    ) const noexcept {
+        return set.find_last_of(str);
+    }
+    
     template <meta::character CharT, std::size_t Cap1, std::size_t Cap2>
     [[nodiscard]] constexpr std::size_t operator()(
         const basic_fstring<CharT, Cap1>& str,
-        const basic_fstring<CharT, Cap2>& charset
+        const basic_fstring<CharT, Cap2>& chars
     ) const noexcept {
-        for (std::size_t i = str.size(); i > 0; --i) {
-            for (std::size_t j = 0; j < charset.size(); ++j) {
-                if (str[i - 1] == charset[j]) {
-                    return i - 1;
-                }
-            }
-        }
-        return basic_fstring<CharT, Cap1>::npos;
+        return scan_set<set_scan::last_of, CharT>(str, chars);
     }
     
     template <meta::character CharT, std::size_t Cap>
     [[nodiscard]] constexpr std::size_t operator()(
         const basic_fstring<CharT, Cap>& str,
-        const CharT* charset
+        const CharT* chars
     ) const noexcept {
-        if (charset == nullptr) return basic_fstring<CharT, Cap>::npos;
-        
-        for (std::size_t i = str.size(); i > 0; --i) {
-            for (std::size_t j = 0; charset[j] != CharT{}; ++j) {
-                if (str[i - 1] == charset[j]) {
-                    return i - 1;
-                }
-            }
-        }
-        return basic_fstring<CharT, Cap>::npos;
+        if (chars == nullptr) return basic_fstring<CharT, Cap>::npos;
+        return scan_set<set_scan::last_of, CharT>(str, chars);
     }
     
     // Factory for piping
+    template <meta::character CharT>
+    [[nodiscard]] constexpr auto operator()(const charset<CharT>& set) const noexcept {
+        return [set, this](const auto& str) {
+            return (*this)(str, set);
+        };
+    }
+    
     template <meta::character CharT, std::size_t Cap>
-    [[nodiscard]] constexpr auto operator()(const basic_fstring<CharT, Cap>& charset) const noexcept {
-        return [charset, this](const auto& str) {
-            return (*this)(str, charset);
+    [[nodiscard]] constexpr auto operator()(const basic_fstring<CharT, Cap>& chars) const noexcept {
+        return [chars, this](const auto& str) {
+            return (*this)(str, chars);
+        };
+    }
+    
+    template <meta::character CharT>
+    [[nodiscard]] constexpr auto operator()(const CharT* chars) const noexcept {
+        return [chars, this](const auto& str) {
+            return (*this)(str, chars);
         };
     }
 };
@@ -448,30 +521,120 @@ inline constexpr find_last_of_fn find_last_of;
 // ==================== Find First Not Of ====================
 
 struct find_first_not_of_fn {
+    template <meta::character CharT, std::size_t Cap>
+    [[nodiscard]] constexpr std::size_t operator()(
+        const basic_fstring<CharT, Cap>& str,
+        const charset<CharT>& set
+    ) const noexcept {
+        return set.find_first_not_of(str);
+    }
+    
     template <meta::character CharT, std::size_t Cap1, std::size_t Cap2>
     [[nodiscard]] constexpr std::size_t operator()(
         const basic_fstring<CharT, Cap1>& str,
-        const basic_fstring<CharT, Cap2>& charset
+        const basic_fstring<CharT, Cap2>& chars
     ) const noexcept {
-        for (std::size_t i = 0; i < str.size(); ++i) {
-            bool found = false;
-            for (std::size_t j = 0; j < charset.size(); ++j) {
-                if (str[i] == charset[j]) {
-                    found = true;
-                    break;
-                }
-            }
-            if (!found) return i;
-        }
-        return basic_fstring<CharT, Cap1>::npos;
+        return scan_set<set_scan::first_not_of, CharT>(str, chars);
+    }
+    
+    template <meta::character CharT, std::size_t Cap>
+    [[nodiscard]] constexpr std::size_t operator()(
+        const basic_fstring<CharT, Cap>& str,
+        const CharT* chars
+    ) const noexcept {
+        if (chars == nullptr) return str.empty() ? basic_fstring<CharT, Cap>::npos : 0;
+        return scan_set<set_scan::first_not_of, CharT>(str, chars);
+    }
+    
+    // Factory for piping
+    template <meta::character CharT>
+    [[nodiscard]] constexpr auto operator()(const charset<CharT>& set) const noexcept {
+        return [set, this](const auto& str) {
+            return (*this)(str, set);
+        };
+    }
+    
+    template <meta::character CharT, std::size_t Cap>
+    [[nodiscard]] constexpr auto operator()(const basic_fstring<CharT, Cap>& chars) const noexcept {
+        return [chars, this](const auto& str) {
+            return (*this)(str, chars);
+        };
+    }
+    
+    template <meta::character CharT>
+    [[nodiscard]] constexpr auto operator()(const CharT* chars) const noexcept {
+        return [chars, this](const auto& str) {
+            return (*this)(str, chars);
+        };
     }
 };
 
 inline constexpr find_first_not_of_fn find_first_not_of;
 
+// ==================== Find Last Not Of ====================
+
+struct find_last_not_of_fn {
+    template <meta::character CharT, std::size_t Cap>
+    [[nodiscard]] constexpr std::size_t operator()(
+        const basic_fstring<CharT, Cap>& str,
+        const charset<CharT>& set
+    ) const noexcept {
+        return set.find_last_not_of(str);
+    }
+    
+    template <meta::character CharT, std::size_t Cap1, std::size_t Cap2>
+    [[nodiscard]] constexpr std::size_t operator()(
+        const basic_fstring<CharT, Cap1>& str,
+        const basic_fstring<CharT, Cap2>& chars
+    ) const noexcept {
+        return scan_set<set_scan::last_not_of, CharT>(str, chars);
+    }
+    
+    template <meta::character CharT, std::size_t Cap>
+    [[nodiscard]] constexpr std::size_t operator()(
+        const basic_fstring<CharT, Cap>& str,
+        const CharT* chars
+    ) const noexcept {
+        if (chars == nullptr) return str.empty() ? basic_fstring<CharT, Cap>::npos : str.size() - 1;
+        return scan_set<set_scan::last_not_of, CharT>(str, chars);
+    }
+    
+    // Factory for piping
+    template <meta::character CharT>
+    [[nodiscard]] constexpr auto operator()(const charset<CharT>& set) const noexcept {
+        return [set, this](const auto& str) {
+            return (*this)(str, set);
+        };
+    }
+    
+    template <meta::character CharT, std::size_t Cap>
+    [[nodiscard]] constexpr auto operator()(const basic_fstring<CharT, Cap>& chars) const noexcept {
+        return [chars, this](const auto& str) {
+            return (*this)(str, chars);
+        };
+    }
+    
+    template <meta::character CharT>
+    [[nodiscard]] constexpr auto operator()(const CharT* chars) const noexcept {
+        return [chars, this](const auto& str) {
+            return (*this)(str, chars);
+        };
+    }
+};
+
+inline constexpr find_last_not_of_fn find_last_not_of;
+
 // ==================== Contains Any (Check if any char from set exists) ====================
 
 struct contains_any_fn {
+    template <meta::character CharT, std::size_t Cap>
+    [[nodiscard]] constexpr bool operator()(
+        const basic_fstring<CharT, Cap>& str,
+        const charset<CharT>& set
+    ) const noexcept {
+        return set.contains_any(str);
+    }
+    
     template <meta::character CharT, std::size_t Cap>
     [[nodiscard]] constexpr bool operator()(
         const basic_fstring<CharT, Cap>& str,
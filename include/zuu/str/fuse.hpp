@@ -0,0 +1,404 @@
+#pragma once
+
+/**
+ * @file zuu/str/fuse.hpp
+ * @brief Single-pass evaluation of composed pipelines
+ * @version 3.0.0
+ *
+ * Design Philosophy:
+ * - `trim | to_lower | to_title` composes into fused_pipe<trim_fn,
+ *   to_lower_fn, to_title_fn> instead of nested composed_pipe, chosen at
+ *   compile time from the stage types
+ * - Narrowing stages (trim, substr) only move the ends of a view, so they
+ *   cost no copy; consecutive element-wise stages (case mapping, replace,
+ *   filter) run as one loop writing straight into the result buffer
+ * - A narrowing stage after element-wise ones narrows the written window
+ *   in place; the next element-wise run then reads and writes that same
+ *   buffer, so the whole pipeline owns one buffer
+ *
+ * Stage protocol (any one member makes a type fusable):
+ *   narrow(basic_string_view<CharT>) -> basic_string_view<CharT>
+ *   map(CharT) -> CharT
+ *   keep(CharT) -> bool                           // false drops the char
+ *   step(fuse_state&, CharT) -> CharT             // map with per-run state
+ *
+ * A mapping stage may also provide map_n(const CharT*, size_t, CharT*),
+ * a bulk (typically vectorized) form of map; a run made of that stage
+ * alone calls it at runtime instead of the per-character loop.
+ *
+ * Usage:
+ *   constexpr auto normalize = trim | to_lower | replace_char('_', ' ');
+ *   auto key = raw | normalize;                   // one loop, one buffer
+ *   normalize.into(out, sv);                      // caller-chosen capacity
+ *   line |= normalize;                            // in place, no second buffer
+ *   auto k = std::move(line) | normalize;         // rvalue: rewritten where it is
+ *
+ * `str | trim | to_lower` still evaluates left to right, one stage at a
+ * time; group the stages, or name the pipeline, to get the fused form.
+ */
+
+#include "../core/core.hpp"
+#include "pipe.hpp"
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace zuu::str {
+
+// ==================== Stage Protocol ====================
+
+template <typename S, typename CharT = char>
+concept narrowing_stage = requires(const S& s, std::basic_string_view<CharT> sv) {
+    { s.narrow(sv) } -> std::same_as<std::basic_string_view<CharT>>;
+};
+
+template <typename S, typename CharT = char>
+concept mapping_stage = requires(const S& s, CharT ch) {
+    { s.map(ch) } -> std::same_as<CharT>;
+};
+
+template <typename S, typename CharT = char>
+concept filtering_stage = requires(const S& s, CharT ch) {
+    { s.keep(ch) } -> std::same_as<bool>;
+};
+
+template <typename S, typename CharT = char>
+concept stateful_stage = requires(const S& s, typename S::fuse_state& state, CharT ch) {
+    { s.step(state, ch) } -> std::same_as<CharT>;
+};
+
+template <typename S, typename CharT = char>
+concept bulk_mapping_stage = mapping_stage<S, CharT> &&
+    requires(const S& s, const CharT* src, std::size_t n, CharT* dst) {
+        s.map_n(src, n, dst);
+    };
+
+template <typename S, typename CharT = char>
+concept elementwise_stage =
+    mapping_stage<S, CharT> || filtering_stage<S, CharT> || stateful_stage<S, CharT>;
+
+template <typename S, typename CharT = char>
+concept fusable_stage = narrowing_stage<S, CharT> || elementwise_stage<S, CharT>;
+
+struct no_fuse_state {};
+
+template <typename S>
+struct fuse_state_of {
+    using type = no_fuse_state;
+};
+
+template <typename S>
+requires requires { typename S::fuse_state; }
+struct fuse_state_of<S> {
+    using type = typename S::fuse_state;
+};
+
+// ==================== Fused Pipeline ====================
+
+template <typename... Stages>
+struct fused_pipe {
+    std::tuple<Stages...> stages;
+
+    static constexpr std::size_t size = sizeof...(Stages);
+
+    /**
+     * @brief Loops over the characters: one per run of element-wise
+     *        stages (a narrowing-only pipeline makes its single copy)
+     */
+    static constexpr std::size_t passes = [] {
+        constexpr bool elementwise[] = {elementwise_stage<Stages>...};
+        std::size_t runs = 0;
+        for (std::size_t i = 0; i < size; ++i) {
+            if (elementwise[i] && (i == 0 || !elementwise[i - 1])) ++runs;
+        }
+        return runs == 0 ? 1 : runs;
+    }();
+
+    constexpr explicit fused_pipe(std::tuple<Stages...> s) : stages{std::move(s)} {}
+
+    /**
+     * @brief Write the pipeline's result for `in` into `out` (replacing
+     *        its contents, truncating at Cap)
+     *
+     * `in` may view `out` itself: every write lands at or before the
+     * character it was computed from.
+     */
+    template <meta::character CharT, std::size_t Cap>
+    constexpr basic_fstring<CharT, Cap>& into(
+        basic_fstring<CharT, Cap>& out,
+        std::basic_string_view<CharT> in
+    ) const {
+        out.resize_and_overwrite(Cap, [&](CharT* buf, std::size_t cap) {
+            return run<0>(in, buf, cap);
+        });
+        return out;
+    }
+
+    template <meta::character CharT, std::size_t Cap>
+    constexpr auto operator()(const basic_fstring<CharT, Cap>& str) const {
+        basic_fstring<CharT, Cap> result;
+        into(result, std::basic_string_view<CharT>{str.data(), str.size()});
+        return result;
+    }
+
+    // Rvalues are rewritten in their own storage and moved out
+    template <meta::character CharT, std::size_t Cap>
+    constexpr auto operator()(basic_fstring<CharT, Cap>&& str) const {
+        into(str, std::basic_string_view<CharT>{str.data(), str.size()});
+        return std::move(str);
+    }
+
+    // Other string-likes get the fstring<256> the unfused stages return
+    template <meta::string_like Str>
+    requires (!meta::fixed_string<std::remove_cvref_t<Str>>)
+    constexpr auto operator()(Str&& str) const {
+        using CharT = meta::char_type_of_t<Str>;
+        basic_fstring<CharT, 256> result;
+        if constexpr (requires { std::basic_string_view<CharT>{str}; }) {
+            into(result, std::basic_string_view<CharT>{str});
+        } else {
+            into(result, std::basic_string_view<CharT>{str.data(), str.size()});
+        }
+        return result;
+    }
+
+    template <meta::string_like Str>
+    friend constexpr auto operator|(Str&& str, const fused_pipe& fp) {
+        return fp(std::forward<Str>(str));
+    }
+
+    // In place: s |= trim | to_lower
+    template <meta::character CharT, std::size_t Cap>
+    friend constexpr basic_fstring<CharT, Cap>& operator|=(basic_fstring<CharT, Cap>& str, const fused_pipe& fp) {
+        return fp.into(str, std::basic_string_view<CharT>{str.data(), str.size()});
+    }
+
+private:
+    template <std::size_t I>
+    using stage_t = std::tuple_element_t<I, std::tuple<Stages...>>;
+
+    template <std::size_t I, typename CharT>
+    static constexpr std::size_t run_end() noexcept {
+        constexpr bool elementwise[] = {elementwise_stage<Stages, CharT>...};
+        std::size_t j = I;
+        while (j < size && elementwise[j]) ++j;
+        return j;
+    }
+
+    // Stages [I, size) applied to `src`; returns the length left in `buf`
+    template <std::size_t I, typename CharT>
+    constexpr std::size_t run(std::basic_string_view<CharT> src, CharT* buf, std::size_t cap) const {
+        if constexpr (I == size) {
+            const std::size_t n = src.size() < cap ? src.size() : cap;
+            if (src.data() != buf) std::char_traits<CharT>::move(buf, src.data(), n);
+            return n;
+        } else if constexpr (narrowing_stage<stage_t<I>, CharT>) {
+            return run<I + 1>(std::get<I>(stages).narrow(src), buf, cap);
+        } else {
+            static_assert(elementwise_stage<stage_t<I>, CharT>, "fused_pipe stage does not support this character type");
+            constexpr std::size_t J = run_end<I, CharT>();
+            const std::size_t n = transform<I>(src, buf, cap, std::make_index_sequence<J - I>{});
+            return run<J>({buf, n}, buf, cap);
+        }
+    }
+
+    // One loop through the element-wise stages I, I+1, ..., I+K. Every
+    // character is stored and the cursor advances only if it was kept,
+    // so filters cost no branch
+    template <std::size_t I, typename CharT, std::size_t... K>
+    constexpr std::size_t transform(
+        std::basic_string_view<CharT> src, CharT* buf, std::size_t cap, std::index_sequence<K...>
+    ) const {
+        if constexpr (sizeof...(K) == 1 && bulk_mapping_stage<stage_t<I>, CharT>) {
+            if (!std::is_constant_evaluated()) {
+                const std::size_t n = src.size() < cap ? src.size() : cap;
+                std::get<I>(stages).map_n(src.data(), n, buf);
+                return n;
+            }
+        }
+
+        std::tuple<typename fuse_state_of<stage_t<I + K>>::type...> states{};
+        std::size_t w = 0;
+
+        const auto step = [&](std::size_t i) {
+            CharT ch = src[i];
+            bool keep = true;
+            (apply<I + K>(std::get<K>(states), ch, keep), ...);
+            buf[w] = ch;
+            w += keep;
+        };
+
+        // The cursor never passes the input position, so only an input
+        // longer than the buffer needs the capacity check
+        std::size_t i = 0;
+        if (src.size() <= cap) {
+            for (; i < src.size(); ++i) step(i);
+        } else {
+            for (; i < src.size() && w < cap; ++i) step(i);
+        }
+        return w;
+    }
+
+    // Stateful stages only see characters no earlier stage dropped
+    template <std::size_t I, typename State, typename CharT>
+    constexpr void apply(State& state, CharT& ch, bool& keep) const {
+        const auto& stage = std::get<I>(stages);
+        if constexpr (mapping_stage<stage_t<I>, CharT>) {
+            ch = stage.map(ch);
+        } else if constexpr (filtering_stage<stage_t<I>, CharT>) {
+            keep &= stage.keep(ch);
+        } else {
+            // Step a copy and select, so a data-dependent drop is not a branch
+            State next = state;
+            const CharT mapped = stage.step(next, ch);
+            state = keep ? next : state;
+            ch = keep ? mapped : ch;
+        }
+    }
+};
+
+template <typename T>
+inline constexpr bool is_fused_pipe_v = false;
+
+template <typename... Stages>
+inline constexpr bool is_fused_pipe_v<fused_pipe<Stages...>> = true;
+
+template <typename Fn>
+concept fusable_operand = fusable_stage<Fn> || is_fused_pipe_v<Fn>;
+
+template <typename Tuple>
+struct fused_pipe_from;
+
+template <typename... Stages>
+struct fused_pipe_from<std::tuple<Stages...>> {
+    using type = fused_pipe<Stages...>;
+};
+
+template <typename Fn>
+constexpr auto fuse_stages(Fn fn) {
+    if constexpr (is_fused_pipe_v<Fn>) {
+        return std::move(fn.stages);
+    } else {
+        return std::tuple<Fn>{std::move(fn)};
+    }
+}
+
+// Fusing composition: preferred over composed_pipe when both sides fuse
+template <typename Fn1, typename Fn2>
+requires pipe_stage<Fn1> && pipe_stage<Fn2> &&
+         fusable_operand<Fn1> && fusable_operand<Fn2>
+constexpr auto operator|(Fn1 f1, Fn2 f2) {
+    auto stages = std::tuple_cat(fuse_stages(std::move(f1)), fuse_stages(std::move(f2)));
+    return typename fused_pipe_from<decltype(stages)>::type{std::move(stages)};
+}
+
+// ==================== Fusable Stage Base ====================
+
+/**
+ * @brief CRTP base giving a protocol stage its eager form:
+ *        stage(str) and str | stage run it as a one-stage fused_pipe
+ */
+template <typename Derived>
+struct fusable_adaptor {
+    template <meta::string_like Str>
+    constexpr auto operator()(Str&& str) const {
+        return run_alone(*this, std::forward<Str>(str));
+    }
+
+    template <meta::string_like Str>
+    friend constexpr auto operator|(Str&& str, const fusable_adaptor& stage) {
+        return stage(std::forward<Str>(str));
+    }
+
+    template <meta::character CharT, std::size_t Cap>
+    friend constexpr basic_fstring<CharT, Cap>& operator|=(basic_fstring<CharT, Cap>& str, const fusable_adaptor& stage) {
+        return str |= alone(stage);
+    }
+
+private:
+    // Delays naming Derived until it is complete
+    template <typename Self>
+    static constexpr auto alone(const Self& self) {
+        return fused_pipe<Derived>{std::tuple<Derived>{static_cast<const Derived&>(self)}};
+    }
+
+    template <typename Self, meta::string_like Str>
+    static constexpr auto run_alone(const Self& self, Str&& str) {
+        return alone(self)(std::forward<Str>(str));
+    }
+};
+
+// ==================== In Place ====================
+
+/**
+ * @brief Run a stage or fused pipeline over `str` in its own storage
+ *
+ * No second buffer: narrowing moves the window and element-wise stages
+ * write at or before the character they read. Returns `str`.
+ */
+template <meta::character CharT, std::size_t Cap, typename Pipeline>
+requires fusable_stage<Pipeline, CharT> || is_fused_pipe_v<Pipeline>
+constexpr basic_fstring<CharT, Cap>& apply_inplace(basic_fstring<CharT, Cap>& str, const Pipeline& pipeline) {
+    if constexpr (is_fused_pipe_v<Pipeline>) {
+        return str |= pipeline;
+    } else {
+        return str |= fused_pipe<Pipeline>{std::tuple<Pipeline>{pipeline}};
+    }
+}
+
+/**
+ * @brief Named in-place form of a stateless stage (to_lower_inplace, ...)
+ */
+template <typename Stage>
+struct inplace_fn {
+    template <meta::character CharT, std::size_t Cap>
+    constexpr basic_fstring<CharT, Cap>& operator()(basic_fstring<CharT, Cap>& str) const {
+        return str |= Stage{};
+    }
+};
+
+// ==================== Zero-Copy View ====================
+
+// Inputs a view may outlive: views and pointers, not owning temporaries
+template <typename T>
+inline constexpr bool borrowed_string_v = std::is_pointer_v<T>;
+
+template <typename CharT, typename Traits>
+inline constexpr bool borrowed_string_v<std::basic_string_view<CharT, Traits>> = true;
+
+/**
+ * @brief Zero-copy form of a narrowing stage (trim_view, ...): the window
+ *        the stage keeps, as a basic_string_view into the argument
+ *
+ * Any capacity and any string-like, never copied or truncated. Owning
+ * rvalues are rejected since the view would dangle.
+ */
+template <typename Stage>
+struct view_fn {
+    Stage stage{};
+
+    template <meta::string_like Str>
+    requires (std::is_lvalue_reference_v<Str> || borrowed_string_v<std::remove_cvref_t<Str>>)
+    constexpr auto operator()(Str&& str) const {
+        using CharT = meta::char_type_of_t<Str>;
+        if constexpr (requires { std::basic_string_view<CharT>{str}; }) {
+            return stage.narrow(std::basic_string_view<CharT>{str});
+        } else {
+            return stage.narrow(std::basic_string_view<CharT>{str.data(), str.size()});
+        }
+    }
+
+    template <meta::string_like Str>
+    requires (!std::is_lvalue_reference_v<Str> && !borrowed_string_v<std::remove_cvref_t<Str>>)
+    void operator()(Str&& str) const = delete;
+
+    template <meta::string_like Str>
+    friend constexpr auto operator|(Str&& str, const view_fn& fn) -> decltype(fn(std::forward<Str>(str))) {
+        return fn(std::forward<Str>(str));
+    }
+};
+
+} // namespace zuu::str
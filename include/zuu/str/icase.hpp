@@ -0,0 +1,229 @@
+#pragma once
+
+/**
+ * @file zuu/str/icase.hpp
+ * @brief ASCII case-insensitive search, comparison and ordering
+ * @version 3.0.0
+ *
+ * Design Philosophy:
+ * - Units are compared after char_to_lower on both sides; nothing is
+ *   lowercased into a copy first
+ * - Runtime paths fold whole vectors (simd.hpp): prefix/suffix checks and
+ *   comparison through mismatch_ignore_case, search through the
+ *   case-insensitive substring_searcher (vector filter for short needles,
+ *   Two-Way otherwise); constant evaluation uses the scalar loops
+ * - Ordering is weak: "ABC" and "abc" are equivalent, and otherwise the
+ *   lowercased units order like basic_fstring's own comparison
+ * - Hashing lives next to hash_string: hash_string_icase and
+ *   fstring_icase_hash / fstring_icase_equal (hash.hpp)
+ *
+ * Usage:
+ *   auto pos = find_ignore_case(header, "content-type");
+ *   bool has = line | contains_ignore_case("TODO");
+ *   bool json = starts_with_ignore_case(mime, "Application/JSON");
+ *   auto order = compare_ignore_case(a, b);              // std::weak_ordering
+ *   std::map<fstring<32>, int, icase_less> columns;      // SQL identifiers
+ */
+
+#include "../core/core.hpp"
+#include "../core/search.hpp"
+#include "case.hpp"
+#include <compare>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace zuu::str {
+
+// ==================== Find ====================
+
+struct find_ignore_case_fn {
+    template <meta::character CharT, std::size_t Cap>
+    [[nodiscard]] constexpr std::size_t operator()(
+        const basic_fstring<CharT, Cap>& str,
+        CharT ch,
+        std::size_t pos = 0
+    ) const noexcept {
+        return (*this)(str, std::basic_string_view<CharT>{&ch, 1}, pos);
+    }
+
+    template <meta::character CharT, std::size_t Cap>
+    [[nodiscard]] constexpr std::size_t operator()(
+        const basic_fstring<CharT, Cap>& str,
+        std::type_identity_t<std::basic_string_view<CharT>> substr,
+        std::size_t pos = 0
+    ) const noexcept {
+        const detail::substring_searcher_icase<CharT> engine{substr.data(), substr.size()};
+        const std::size_t found = engine.find(str.data(), str.size(), pos);
+        return found == engine.npos ? basic_fstring<CharT, Cap>::npos : found;
+    }
+
+    // Factory for piping
+    template <meta::character CharT>
+    [[nodiscard]] constexpr auto operator()(CharT ch, std::size_t pos = 0) const noexcept {
+        return [ch, pos, this](const auto& str) {
+            return (*this)(str, ch, pos);
+        };
+    }
+
+    template <meta::character CharT>
+    [[nodiscard]] constexpr auto operator()(const CharT* substr, std::size_t pos = 0) const noexcept {
+        return [substr, pos, this](const auto& str) {
+            return (*this)(str, substr, pos);
+        };
+    }
+};
+
+inline constexpr find_ignore_case_fn find_ignore_case;
+
+// ==================== Contains ====================
+
+struct contains_ignore_case_fn {
+    template <meta::character CharT, std::size_t Cap>
+    [[nodiscard]] constexpr bool operator()(
+        const basic_fstring<CharT, Cap>& str,
+        CharT ch
+    ) const noexcept {
+        return find_ignore_case(str, ch) != basic_fstring<CharT, Cap>::npos;
+    }
+
+    template <meta::character CharT, std::size_t Cap>
+    [[nodiscard]] constexpr bool operator()(
+        const basic_fstring<CharT, Cap>& str,
+        std::type_identity_t<std::basic_string_view<CharT>> substr
+    ) const noexcept {
+        return find_ignore_case(str, substr) != basic_fstring<CharT, Cap>::npos;
+    }
+
+    // Factory for piping
+    template <meta::character CharT>
+    [[nodiscard]] constexpr auto operator()(CharT ch) const noexcept {
+        return [ch, this](const auto& str) {
+            return (*this)(str, ch);
+        };
+    }
+
+    template <meta::character CharT>
+    [[nodiscard]] constexpr auto operator()(const CharT* substr) const noexcept {
+        return [substr, this](const auto& str) {
+            return (*this)(str, substr);
+        };
+    }
+};
+
+inline constexpr contains_ignore_case_fn contains_ignore_case;
+
+// ==================== Starts / Ends With ====================
+
+struct starts_with_ignore_case_fn {
+    template <meta::character CharT, std::size_t Cap>
+    [[nodiscard]] constexpr bool operator()(
+        const basic_fstring<CharT, Cap>& str,
+        std::type_identity_t<std::basic_string_view<CharT>> prefix
+    ) const noexcept {
+        return prefix.size() <= str.size() &&
+               mismatch_ignore_case(str.data(), prefix.data(), prefix.size()) == prefix.size();
+    }
+
+    // Factory for piping
+    template <meta::character CharT>
+    [[nodiscard]] constexpr auto operator()(const CharT* prefix) const noexcept {
+        return [prefix, this](const auto& str) {
+            return (*this)(str, prefix);
+        };
+    }
+};
+
+inline constexpr starts_with_ignore_case_fn starts_with_ignore_case;
+
+struct ends_with_ignore_case_fn {
+    template <meta::character CharT, std::size_t Cap>
+    [[nodiscard]] constexpr bool operator()(
+        const basic_fstring<CharT, Cap>& str,
+        std::type_identity_t<std::basic_string_view<CharT>> suffix
+    ) const noexcept {
+        if (suffix.size() > str.size()) return false;
+        const CharT* tail = str.data() + (str.size() - suffix.size());
+        return mismatch_ignore_case(tail, suffix.data(), suffix.size()) == suffix.size();
+    }
+
+    // Factory for piping
+    template <meta::character CharT>
+    [[nodiscard]] constexpr auto operator()(const CharT* suffix) const noexcept {
+        return [suffix, this](const auto& str) {
+            return (*this)(str, suffix);
+        };
+    }
+};
+
+inline constexpr ends_with_ignore_case_fn ends_with_ignore_case;
+
+// ==================== Three-Way Comparison ====================
+
+struct compare_ignore_case_fn {
+    // Views on both sides; the fstring overloads deduce CharT for them
+    template <meta::character CharT>
+    [[nodiscard]] static constexpr std::weak_ordering compare(
+        std::basic_string_view<CharT> lhs,
+        std::basic_string_view<CharT> rhs
+    ) noexcept {
+        const std::size_t common = lhs.size() < rhs.size() ? lhs.size() : rhs.size();
+        const std::size_t i = mismatch_ignore_case(lhs.data(), rhs.data(), common);
+        if (i < common) {
+            const CharT a = char_to_lower(lhs[i]);
+            const CharT b = char_to_lower(rhs[i]);
+            return std::char_traits<CharT>::lt(a, b) ? std::weak_ordering::less : std::weak_ordering::greater;
+        }
+        return lhs.size() <=> rhs.size();
+    }
+
+    template <meta::character CharT, std::size_t Cap>
+    [[nodiscard]] constexpr std::weak_ordering operator()(
+        const basic_fstring<CharT, Cap>& lhs,
+        std::type_identity_t<std::basic_string_view<CharT>> rhs
+    ) const noexcept {
+        return compare<CharT>(lhs, rhs);
+    }
+
+    template <meta::character CharT, std::size_t Cap>
+    [[nodiscard]] constexpr std::weak_ordering operator()(
+        std::type_identity_t<std::basic_string_view<CharT>> lhs,
+        const basic_fstring<CharT, Cap>& rhs
+    ) const noexcept {
+        return compare<CharT>(lhs, rhs);
+    }
+
+    template <meta::character CharT, std::size_t Cap1, std::size_t Cap2>
+    [[nodiscard]] constexpr std::weak_ordering operator()(
+        const basic_fstring<CharT, Cap1>& lhs,
+        const basic_fstring<CharT, Cap2>& rhs
+    ) const noexcept {
+        return compare<CharT>(lhs, rhs);
+    }
+};
+
+inline constexpr compare_ignore_case_fn compare_ignore_case;
+
+// ==================== Ordered Container Functor ====================
+
+/**
+ * @brief Transparent case-insensitive less-than for ordered containers;
+ *        pairs with compare_ignore_case
+ */
+template <meta::character CharT>
+struct basic_icase_less {
+    using is_transparent = void;
+
+    [[nodiscard]] constexpr bool operator()(
+        std::basic_string_view<CharT> lhs,
+        std::basic_string_view<CharT> rhs
+    ) const noexcept {
+        return compare_ignore_case_fn::compare(lhs, rhs) < 0;
+    }
+};
+
+using icase_less = basic_icase_less<char>;
+using wicase_less = basic_icase_less<wchar_t>;
+
+} // namespace zuu::str
@@ -0,0 +1,551 @@
+#pragma once
+
+/**
+ * @file zuu/str/multi_matcher.hpp
+ * @brief Aho-Corasick multi-pattern matcher with a compact dense DFA
+ * @version 3.0.0
+ *
+ * Usage:
+ *   // Compile time: tables are sized exactly and live in .rodata
+ *   static constexpr std::string_view keywords[] = {"GET", "POST", "PUT"};
+ *   static constexpr auto methods = str::make_multi_matcher<keywords>();
+ *
+ *   // Runtime: any range of string-likes
+ *   str::multi_matcher<char> blocklist{words_vector};
+ *
+ *   bool hit   = line | contains(methods);
+ *   auto first = line | match_first(methods);   // multi_match
+ *   auto mask  = line | match_mask(blocklist);  // pattern_mask
+ *   blocklist.for_each_match(line, [](str::multi_match m) { ... });
+ */
+
+#include "../core/core.hpp"
+#include "searcher.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <ranges>
+#include <span>
+#include <vector>
+
+namespace zuu::str {
+
+// ==================== Match Result ====================
+
+/**
+ * @brief A single keyword occurrence
+ */
+struct multi_match {
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    std::size_t pattern = npos;    // index of the keyword in the input set
+    std::size_t position = npos;   // start offset in the scanned string
+    std::size_t length = 0;
+
+    [[nodiscard]] constexpr bool found() const noexcept { return pattern != npos; }
+    [[nodiscard]] constexpr explicit operator bool() const noexcept { return found(); }
+};
+
+// ==================== Pattern Mask ====================
+
+/**
+ * @brief One bit per keyword; fixed-size when Patterns is static
+ */
+template <std::size_t Patterns = std::dynamic_extent>
+class pattern_mask {
+    static constexpr bool dynamic = Patterns == std::dynamic_extent;
+    using words_type = std::conditional_t<dynamic,
+        std::vector<std::uint64_t>,
+        std::array<std::uint64_t, (Patterns + 63) / 64>>;
+
+    words_type words_{};
+    std::size_t size_ = dynamic ? 0 : Patterns;
+
+public:
+    constexpr pattern_mask() noexcept = default;
+
+    constexpr explicit pattern_mask(std::size_t patterns) : size_{patterns} {
+        if constexpr (dynamic) words_.assign((patterns + 63) / 64, 0);
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return size_; }
+
+    constexpr void set(std::size_t idx) noexcept {
+        words_[idx / 64] |= std::uint64_t{1} << (idx % 64);
+    }
+
+    [[nodiscard]] constexpr bool test(std::size_t idx) const noexcept {
+        return (words_[idx / 64] >> (idx % 64)) & 1;
+    }
+
+    [[nodiscard]] constexpr bool any() const noexcept {
+        for (auto w : words_) if (w != 0) return true;
+        return false;
+    }
+
+    [[nodiscard]] constexpr bool none() const noexcept { return !any(); }
+
+    [[nodiscard]] constexpr std::size_t count() const noexcept {
+        std::size_t n = 0;
+        for (auto w : words_) n += static_cast<std::size_t>(std::popcount(w));
+        return n;
+    }
+
+    [[nodiscard]] constexpr bool operator[](std::size_t idx) const noexcept { return test(idx); }
+};
+
+} // namespace zuu::str
+
+namespace zuu::detail {
+
+// ==================== Automaton Builder ====================
+
+/**
+ * @brief Transient Aho-Corasick construction (constexpr, heap-backed)
+ *
+ * Code units are first mapped to dense equivalence classes: class 0 is
+ * "appears in no keyword", so the transition table has one column per
+ * distinct keyword code unit instead of one per alphabet symbol. The goto
+ * function is then completed into a full DFA in BFS order.
+ */
+template <meta::character CharT>
+struct ac_builder {
+    using unit = std::make_unsigned_t<CharT>;
+    static constexpr std::uint32_t none = static_cast<std::uint32_t>(-1);
+
+    std::uint16_t byte_class[256]{};
+    std::vector<std::pair<CharT, std::uint32_t>> wide;   // sorted, units >= 256
+    std::uint32_t classes = 1;
+    std::uint32_t states = 1;
+    std::vector<std::uint32_t> next;      // states * classes, target state
+    std::vector<std::uint32_t> out;       // pattern ending exactly here
+    std::vector<std::uint32_t> dict;      // nearest proper suffix state with output
+    std::vector<std::size_t> lengths;     // per pattern
+
+    template <typename R>
+    constexpr explicit ac_builder(const R& keywords) {
+        // Pass 1: alphabet compression
+        std::size_t total = 0;
+        for (const auto& kw : keywords) {
+            const std::basic_string_view<CharT> sv{kw};
+            total += sv.size();
+            for (CharT ch : sv) {
+                const auto u = static_cast<unit>(ch);
+                if (u < 256) {
+                    if (byte_class[u] == 0) byte_class[u] = static_cast<std::uint16_t>(classes++);
+                } else if (std::ranges::find(wide, ch, [](const auto& p) { return p.first; }) == wide.end()) {
+                    wide.emplace_back(ch, classes++);
+                }
+            }
+        }
+        std::ranges::sort(wide, {}, [](const auto& p) { return static_cast<unit>(p.first); });
+
+        // Pass 2: trie (edge target 0 means "no edge"; root is never a child)
+        // Sized for the worst case up front, trimmed once the trie is built
+        next.assign((total + 1) * classes, 0);
+        out.assign(total + 1, none);
+        for (const auto& kw : keywords) {
+            const std::basic_string_view<CharT> sv{kw};
+            const auto id = static_cast<std::uint32_t>(lengths.size());
+            lengths.push_back(sv.size());
+            if (sv.empty()) continue;
+
+            std::uint32_t s = 0;
+            for (CharT ch : sv) {
+                const std::uint32_t c = class_of(ch);
+                if (next[s * classes + c] == 0) {
+                    next[s * classes + c] = states++;
+                }
+                s = next[s * classes + c];
+            }
+            if (out[s] == none) out[s] = id;   // duplicates report the first id
+        }
+        next.resize(std::size_t{states} * classes);
+        out.resize(states);
+
+        // Pass 3: failure links folded into a complete DFA (BFS order)
+        std::vector<std::uint32_t> fail(states, 0);
+        std::vector<std::uint32_t> queue;
+        queue.reserve(states);
+        dict.assign(states, none);
+
+        for (std::uint32_t c = 0; c < classes; ++c) {
+            const std::uint32_t t = next[c];
+            if (t != 0) queue.push_back(t);
+        }
+        for (std::size_t head = 0; head < queue.size(); ++head) {
+            const std::uint32_t s = queue[head];
+            const std::uint32_t f = fail[s];
+            dict[s] = out[f] != none ? f : dict[f];
+            for (std::uint32_t c = 0; c < classes; ++c) {
+                std::uint32_t& t = next[s * classes + c];
+                if (t != 0) {
+                    fail[t] = next[f * classes + c];
+                    queue.push_back(t);
+                } else {
+                    t = next[f * classes + c];
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] constexpr std::uint32_t class_of(CharT ch) const noexcept {
+        const auto u = static_cast<unit>(ch);
+        if (u < 256) return byte_class[u];
+        const auto it = std::ranges::lower_bound(wide, u, {},
+            [](const auto& p) { return static_cast<unit>(p.first); });
+        return (it != wide.end() && it->first == ch) ? it->second : 0;
+    }
+};
+
+struct ac_plan {
+    std::size_t states;
+    std::size_t classes;
+    std::size_t patterns;
+};
+
+template <meta::character CharT, typename R>
+constexpr ac_plan plan_multi_matcher(const R& keywords) {
+    const ac_builder<CharT> b{keywords};
+    return {b.states, b.classes, b.lengths.size()};
+}
+
+} // namespace zuu::detail
+
+namespace zuu::str {
+
+// ==================== Multi Matcher ====================
+
+/**
+ * @brief Aho-Corasick automaton over a keyword set
+ *
+ * With the default (dynamic) extents the tables are heap-allocated and
+ * built at runtime. With static extents (see make_multi_matcher) every
+ * table is a fixed array, so a constexpr matcher needs no runtime setup.
+ *
+ * Layout: a dense `states x classes` transition table whose cells hold the
+ * premultiplied row of the target state plus an "accepting" flag in the
+ * top bit, so the scan loop is one load and one add per code unit. Cells
+ * are 16-bit when the whole table fits, otherwise 32-bit.
+ *
+ * Matches are reported in order of their end position; at one end
+ * position the longest keyword comes first.
+ */
+template <meta::character CharT,
+          std::size_t States = std::dynamic_extent,
+          std::size_t Classes = std::dynamic_extent,
+          std::size_t Patterns = std::dynamic_extent>
+class multi_matcher {
+    static constexpr bool dynamic = States == std::dynamic_extent;
+    static_assert(dynamic == (Classes == std::dynamic_extent) &&
+                  dynamic == (Patterns == std::dynamic_extent),
+                  "multi_matcher extents must be all static or all dynamic");
+
+public:
+    using value_type = CharT;
+    using size_type = std::size_t;
+    using mask_type = pattern_mask<Patterns>;
+    using cell_type = std::conditional_t<!dynamic && (States * Classes < 0x8000),
+                                         std::uint16_t, std::uint32_t>;
+    using class_type = std::conditional_t<!dynamic && (Classes <= 0x100),
+                                          std::uint8_t, std::uint16_t>;
+
+    static constexpr size_type npos = multi_match::npos;
+
+private:
+    using unit = std::make_unsigned_t<CharT>;
+    static constexpr cell_type accept_bit = cell_type{1} << (sizeof(cell_type) * 8 - 1);
+    static constexpr std::uint32_t none = detail::ac_builder<CharT>::none;
+
+    template <typename T, std::size_t N>
+    using storage = std::conditional_t<dynamic, std::vector<T>, std::array<T, N>>;
+
+    size_type classes_ = 1;
+    class_type byte_class_[256]{};
+    storage<std::pair<CharT, std::uint32_t>, (dynamic ? 0 : Classes)> wide_{};
+    size_type wide_count_ = 0;
+    storage<cell_type, (dynamic ? 0 : States * Classes)> next_{};
+    storage<std::uint32_t, (dynamic ? 0 : States)> out_{};
+    storage<std::uint32_t, (dynamic ? 0 : States)> dict_{};
+    storage<size_type, (dynamic ? 0 : Patterns)> lengths_{};
+    size_type patterns_ = 0;
+
+    template <typename Dst, typename Src>
+    static constexpr void fill(Dst& dst, const Src& src) {
+        if constexpr (dynamic) dst.resize(src.size());
+        std::ranges::copy(src, dst.begin());
+    }
+
+    constexpr void init(const detail::ac_builder<CharT>& b) {
+        classes_ = b.classes;
+        patterns_ = b.lengths.size();
+        wide_count_ = b.wide.size();
+        for (size_type u = 0; u < 256; ++u) {
+            byte_class_[u] = static_cast<class_type>(b.byte_class[u]);
+        }
+        fill(wide_, b.wide);
+        fill(out_, b.out);
+        fill(dict_, b.dict);
+        fill(lengths_, b.lengths);
+
+        if constexpr (dynamic) next_.resize(b.next.size());
+        for (size_type i = 0; i < b.next.size(); ++i) {
+            const std::uint32_t t = b.next[i];
+            const bool accepting = b.out[t] != none || b.dict[t] != none;
+            next_[i] = static_cast<cell_type>(t * classes_) | (accepting ? accept_bit : cell_type{0});
+        }
+    }
+
+    [[nodiscard]] constexpr size_type class_of(CharT ch) const noexcept {
+        const auto u = static_cast<unit>(ch);
+        if constexpr (sizeof(CharT) == 1) {
+            return byte_class_[u];
+        } else {
+            if (u < 256) return byte_class_[u];
+            size_type lo = 0, hi = wide_count_;
+            while (lo < hi) {
+                const size_type mid = (lo + hi) / 2;
+                if (static_cast<unit>(wide_[mid].first) < u) lo = mid + 1;
+                else hi = mid;
+            }
+            return (lo < wide_count_ && wide_[lo].first == ch) ? wide_[lo].second : 0;
+        }
+    }
+
+    [[nodiscard]] constexpr cell_type step(cell_type row, CharT ch) const noexcept {
+        return next_[(row & ~accept_bit) + class_of(ch)];
+    }
+
+    // Walk the output chain of the state at `row`, ending at offset `end`
+    template <typename Fn>
+    constexpr bool emit(cell_type row, size_type end, Fn& fn) const {
+        std::uint32_t s = static_cast<std::uint32_t>((row & ~accept_bit) / classes_);
+        if (out_[s] == none) s = dict_[s];
+        while (s != none) {
+            const std::uint32_t id = out_[s];
+            const size_type len = lengths_[id];
+            if (!fn(multi_match{id, end - len, len})) return false;
+            s = dict_[s];
+        }
+        return true;
+    }
+
+public:
+    // ==================== Construction ====================
+
+    constexpr multi_matcher() requires dynamic = default;
+
+    /**
+     * @brief Build from any range of string-likes (keyword index = pattern id)
+     *
+     * Empty keywords are accepted but never match. For static extents the
+     * range must match the sizes computed by make_multi_matcher.
+     */
+    template <typename R>
+    requires std::ranges::input_range<R> &&
+             std::convertible_to<std::ranges::range_reference_t<R>, std::basic_string_view<CharT>>
+    constexpr explicit multi_matcher(const R& keywords) {
+        const detail::ac_builder<CharT> b{keywords};
+        if constexpr (!dynamic) {
+            if (b.states > States || b.classes > Classes || b.lengths.size() > Patterns) {
+                throw std::length_error("multi_matcher: keyword set exceeds static extents");
+            }
+        }
+        init(b);
+    }
+
+    constexpr multi_matcher(std::initializer_list<std::basic_string_view<CharT>> keywords)
+        : multi_matcher(std::span{keywords.begin(), keywords.size()}) {}
+
+    // ==================== Observers ====================
+
+    [[nodiscard]] constexpr size_type pattern_count() const noexcept { return patterns_; }
+    [[nodiscard]] constexpr size_type state_count() const noexcept { return next_.size() / classes_; }
+    [[nodiscard]] constexpr size_type class_count() const noexcept { return classes_; }
+    [[nodiscard]] constexpr size_type pattern_length(size_type id) const noexcept { return lengths_[id]; }
+
+    // ==================== Single-Pass Queries ====================
+
+    [[nodiscard]] constexpr bool contains(std::basic_string_view<CharT> hay) const noexcept {
+        cell_type row = 0;
+        for (CharT ch : hay) {
+            row = step(row, ch);
+            if (row & accept_bit) return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Earliest-ending match (longest keyword at that end), or empty
+     */
+    [[nodiscard]] constexpr multi_match find_first(std::basic_string_view<CharT> hay) const noexcept {
+        cell_type row = 0;
+        for (size_type i = 0; i < hay.size(); ++i) {
+            row = step(row, hay[i]);
+            if (row & accept_bit) {
+                multi_match first;
+                auto take = [&](multi_match m) { first = m; return false; };
+                emit(row, i + 1, take);
+                return first;
+            }
+        }
+        return {};
+    }
+
+    /**
+     * @brief Invoke fn(multi_match) for every (overlapping) occurrence
+     *
+     * If fn returns bool, returning false stops the scan.
+     */
+    template <typename Fn>
+    constexpr void for_each_match(std::basic_string_view<CharT> hay, Fn&& fn) const {
+        auto sink = [&](multi_match m) {
+            if constexpr (std::is_same_v<std::invoke_result_t<Fn&, multi_match>, bool>) {
+                return fn(m);
+            } else {
+                fn(m);
+                return true;
+            }
+        };
+        cell_type row = 0;
+        for (size_type i = 0; i < hay.size(); ++i) {
+            row = step(row, hay[i]);
+            if ((row & accept_bit) && !emit(row, i + 1, sink)) return;
+        }
+    }
+
+    /**
+     * @brief Set of keywords occurring anywhere in `hay`
+     */
+    [[nodiscard]] constexpr mask_type match_mask(std::basic_string_view<CharT> hay) const {
+        mask_type mask(patterns_);
+        for_each_match(hay, [&](multi_match m) { mask.set(m.pattern); });
+        return mask;
+    }
+
+    [[nodiscard]] constexpr size_type count(std::basic_string_view<CharT> hay) const noexcept {
+        size_type n = 0;
+        for_each_match(hay, [&](multi_match) { ++n; });
+        return n;
+    }
+
+    // ==================== Batch Queries ====================
+
+    /**
+     * @brief Write contains(record) for each record to `out`
+     *
+     * Records are scanned four at a time with interleaved, independent
+     * state chains, hiding the latency of the dependent table loads.
+     */
+    template <std::ranges::random_access_range R, typename Out>
+    constexpr Out contains_batch(const R& records, Out out) const {
+        const size_type n = std::ranges::size(records);
+        size_type r = 0;
+
+        for (; r + 4 <= n; r += 4) {
+            std::basic_string_view<CharT> sv[4];
+            cell_type row[4]{};
+            bool hit[4]{};
+            size_type common = static_cast<size_type>(-1);
+            for (size_type k = 0; k < 4; ++k) {
+                sv[k] = std::basic_string_view<CharT>{records[r + k]};
+                common = std::min(common, sv[k].size());
+            }
+            for (size_type i = 0; i < common; ++i) {
+                for (size_type k = 0; k < 4; ++k) {
+                    row[k] = step(row[k], sv[k][i]);
+                    hit[k] |= (row[k] & accept_bit) != 0;
+                }
+                if (hit[0] & hit[1] & hit[2] & hit[3]) break;
+            }
+            for (size_type k = 0; k < 4; ++k) {
+                for (size_type i = common; i < sv[k].size() && !hit[k]; ++i) {
+                    row[k] = step(row[k], sv[k][i]);
+                    hit[k] = (row[k] & accept_bit) != 0;
+                }
+                *out++ = hit[k];
+            }
+        }
+        for (; r < n; ++r) {
+            *out++ = contains(std::basic_string_view<CharT>{records[r]});
+        }
+        return out;
+    }
+
+    /**
+     * @brief Write find_first(record) for each record to `out`
+     */
+    template <std::ranges::input_range R, typename Out>
+    constexpr Out find_batch(const R& records, Out out) const {
+        for (const auto& rec : records) {
+            *out++ = find_first(std::basic_string_view<CharT>{rec});
+        }
+        return out;
+    }
+};
+
+// ==================== Deduction Guides ====================
+
+template <typename R>
+requires std::ranges::input_range<R>
+multi_matcher(const R&) -> multi_matcher<meta::char_type_of_t<std::ranges::range_value_t<R>>>;
+
+// ==================== Compile-Time Factory ====================
+
+/**
+ * @brief Build a matcher with exactly-sized static tables
+ *
+ * `Keywords` must be a constexpr range of string-likes with static storage
+ * duration (e.g. a `static constexpr std::string_view[]`).
+ */
+template <const auto& Keywords>
+consteval auto make_multi_matcher() {
+    using keyword_type = std::ranges::range_value_t<decltype(Keywords)>;
+    using char_type = meta::char_type_of_t<keyword_type>;
+    constexpr auto plan = detail::plan_multi_matcher<char_type>(Keywords);
+    return multi_matcher<char_type, plan.states, plan.classes, plan.patterns>{Keywords};
+}
+
+template <meta::character CharT, std::size_t S, std::size_t C, std::size_t P>
+inline constexpr bool enable_precompiled_pattern<multi_matcher<CharT, S, C, P>> = true;
+
+// ==================== Pipe Support ====================
+
+struct match_first_fn {
+    template <meta::character CharT, std::size_t Cap, std::size_t S, std::size_t C, std::size_t P>
+    [[nodiscard]] constexpr multi_match operator()(
+        const basic_fstring<CharT, Cap>& str,
+        const multi_matcher<CharT, S, C, P>& matcher
+    ) const noexcept {
+        return matcher.find_first(str);
+    }
+
+    // Factory for piping: str | match_first(matcher)
+    template <precompiled_pattern Pattern>
+    [[nodiscard]] constexpr auto operator()(Pattern&& matcher) const noexcept {
+        return bind_pattern(*this, std::forward<Pattern>(matcher));
+    }
+};
+
+inline constexpr match_first_fn match_first;
+
+struct match_mask_fn {
+    template <meta::character CharT, std::size_t Cap, std::size_t S, std::size_t C, std::size_t P>
+    [[nodiscard]] constexpr auto operator()(
+        const basic_fstring<CharT, Cap>& str,
+        const multi_matcher<CharT, S, C, P>& matcher
+    ) const {
+        return matcher.match_mask(str);
+    }
+
+    // Factory for piping: str | match_mask(matcher)
+    template <precompiled_pattern Pattern>
+    [[nodiscard]] constexpr auto operator()(Pattern&& matcher) const noexcept {
+        return bind_pattern(*this, std::forward<Pattern>(matcher));
+    }
+};
+
+inline constexpr match_mask_fn match_mask;
+
+} // namespace zuu::str
@@ -145,14 +145,31 @@ struct composed_pipe {
     }
 };
 
-// Composition operator for pipes
+// Anything that can sit on either side of a pipe composition
+template <typename Fn>
+concept pipe_stage = !meta::string_like<std::remove_cvref_t<Fn>>;
+
+// Composition operator for pipes (never takes a string on the left).
+// Stages that can run inside one loop are fused instead (fuse.hpp).
 template <typename Fn1, typename Fn2>
-requires requires(Fn1 f1, Fn2 f2) {
-    { f1 } -> std::convertible_to<Fn1>;
-    { f2 } -> std::convertible_to<Fn2>;
-}
+requires pipe_stage<Fn1> && pipe_stage<Fn2>
 constexpr auto operator|(Fn1 f1, Fn2 f2) {
     return composed_pipe{std::move(f1), std::move(f2)};
 }
 
+// ==================== Apply Plain Callables ====================
+
+/**
+ * @brief Pipe a string into any callable: str | [](auto s) { ... }
+ *
+ * Also covers the lambdas returned by parameterized factories such as
+ * contains('x') or split(',').
+ */
+template <meta::string_like Str, typename Fn>
+requires (!meta::string_like<std::remove_cvref_t<Fn>>) && 
+         std::invocable<const Fn&, Str>
+constexpr auto operator|(Str&& str, const Fn& fn) {
+    return fn(std::forward<Str>(str));
+}
+
 } // namespace zuu::str
\ No newline at end of file
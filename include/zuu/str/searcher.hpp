@@ -0,0 +1,187 @@
+#pragma once
+
+/**
+ * @file zuu/str/searcher.hpp
+ * @brief Precompiled Boyer-Moore-Horspool searcher for repeated needles
+ * @version 3.0.0
+ *
+ * Usage:
+ *   static constexpr str::searcher needle{"ERROR"};   // table built at compile time
+ *   bool hit = line | contains(needle);
+ *   auto pos = needle.find(line);
+ *
+ *   str::searcher<char, 32> dyn{some_fstring};         // built once at runtime
+ */
+
+#include "../core/core.hpp"
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace zuu::str {
+
+// ==================== Searcher ====================
+
+/**
+ * @brief Needle of up to N code units with a precomputed skip table
+ *
+ * The bad-character table has 256 buckets indexed by the low byte of each
+ * code unit, so it is exact for 8-bit characters and conservative (still
+ * correct, shorter shifts) for wider ones. Entries use the smallest
+ * unsigned type able to hold N, which keeps `searcher<char, 64>` at
+ * ~320 bytes. A constexpr searcher is fully materialized at compile time.
+ */
+template <meta::character CharT, std::size_t N>
+class searcher {
+public:
+    using value_type = CharT;
+    using size_type = std::size_t;
+    using skip_type = std::conditional_t<(N < 0xFF), std::uint8_t,
+                      std::conditional_t<(N < 0xFFFF), std::uint16_t, std::uint32_t>>;
+
+    static constexpr size_type capacity = N;
+    static constexpr size_type npos = static_cast<size_type>(-1);
+    static constexpr size_type table_size = 256;
+
+private:
+    basic_fstring<CharT, N> needle_;
+    skip_type skip_[table_size]{};
+
+    static constexpr size_type bucket(CharT ch) noexcept {
+        return static_cast<size_type>(static_cast<std::make_unsigned_t<CharT>>(ch)) & 0xFF;
+    }
+
+    constexpr void build() noexcept {
+        const size_type m = needle_.size();
+        for (auto& s : skip_) s = static_cast<skip_type>(m);
+        // Later positions overwrite earlier ones, so each bucket keeps its minimum shift
+        for (size_type j = 0; j + 1 < m; ++j) {
+            skip_[bucket(needle_[j])] = static_cast<skip_type>(m - 1 - j);
+        }
+    }
+
+    constexpr bool matches_at(const CharT* hay, size_type len) const noexcept {
+        if (!std::is_constant_evaluated()) {
+            return std::memcmp(hay, needle_.data(), len * sizeof(CharT)) == 0;
+        }
+        for (size_type k = 0; k < len; ++k) {
+            if (hay[k] != needle_[k]) return false;
+        }
+        return true;
+    }
+
+public:
+    // ==================== Construction ====================
+
+    constexpr searcher() noexcept { build(); }
+
+    template <size_type M>
+    requires (M - 1 <= N)
+    constexpr searcher(const CharT (&needle)[M]) noexcept
+        : needle_{needle} { build(); }
+
+    template <size_type M>
+    requires (M <= N)
+    constexpr explicit searcher(const basic_fstring<CharT, M>& needle) noexcept
+        : needle_{needle.data(), needle.size()} { build(); }
+
+    // Truncates needles longer than N
+    constexpr explicit searcher(std::basic_string_view<CharT> needle) noexcept
+        : needle_{needle} { build(); }
+
+    // ==================== Observers ====================
+
+    [[nodiscard]] constexpr const basic_fstring<CharT, N>& needle() const noexcept { return needle_; }
+    [[nodiscard]] constexpr size_type size() const noexcept { return needle_.size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return needle_.empty(); }
+
+    [[nodiscard]] constexpr size_type skip(CharT ch) const noexcept {
+        return skip_[bucket(ch)];
+    }
+
+    // ==================== Search ====================
+
+    /**
+     * @brief First occurrence at or after `pos`, or npos
+     */
+    [[nodiscard]] constexpr size_type find(
+        std::basic_string_view<CharT> hay,
+        size_type pos = 0
+    ) const noexcept {
+        const size_type n = hay.size();
+        const size_type m = needle_.size();
+
+        if (pos > n || m > n - pos) return npos;
+        if (m == 0) return pos;
+
+        const CharT* h = hay.data();
+
+        if (m == 1 && !std::is_constant_evaluated()) {
+            const size_type idx = detail::simd::find_char(h + pos, n - pos, needle_[0]);
+            return idx == n - pos ? npos : pos + idx;
+        }
+
+        const size_type last = m - 1;
+        const CharT tail = needle_[last];
+
+        for (size_type i = pos; i + m <= n; ) {
+            const CharT ch = h[i + last];
+            if (ch == tail && matches_at(h + i, last)) return i;
+            i += skip_[bucket(ch)];
+        }
+        return npos;
+    }
+
+    [[nodiscard]] constexpr bool contains(std::basic_string_view<CharT> hay) const noexcept {
+        return find(hay) != npos;
+    }
+
+    // Non-overlapping occurrences
+    [[nodiscard]] constexpr size_type count(std::basic_string_view<CharT> hay) const noexcept {
+        const size_type m = needle_.size();
+        if (m == 0) return 0;
+
+        size_type cnt = 0;
+        for (size_type pos = find(hay); pos != npos; pos = find(hay, pos + m)) {
+            ++cnt;
+        }
+        return cnt;
+    }
+};
+
+// ==================== Deduction Guides ====================
+
+template <meta::character CharT, std::size_t M>
+searcher(const CharT (&)[M]) -> searcher<CharT, M - 1>;
+
+template <meta::character CharT, std::size_t M>
+searcher(const basic_fstring<CharT, M>&) -> searcher<CharT, M>;
+
+// ==================== Detection ====================
+
+// Opt-in trait; other pattern types specialize it next to their definition
+template <typename T>
+inline constexpr bool enable_precompiled_pattern = false;
+
+template <meta::character CharT, std::size_t N>
+inline constexpr bool enable_precompiled_pattern<searcher<CharT, N>> = true;
+
+/**
+ * @brief Precompiled pattern objects (searchers, matchers, ...)
+ *
+ * Pipe factories capture these by reference when given an lvalue, so a
+ * long-lived pattern is never copied per call.
+ */
+template <typename T>
+concept precompiled_pattern = enable_precompiled_pattern<std::remove_cvref_t<T>>;
+
+template <typename Fn, typename Pattern>
+constexpr auto bind_pattern(const Fn& fn, Pattern&& pattern) {
+    if constexpr (std::is_lvalue_reference_v<Pattern>) {
+        return [&fn, &pattern](const auto& str) { return fn(str, pattern); };
+    } else {
+        return [&fn, p = std::move(pattern)](const auto& str) { return fn(str, p); };
+    }
+}
+
+} // namespace zuu::str
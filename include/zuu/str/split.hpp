@@ -8,10 +8,19 @@
  * Usage:
  *   auto parts = split("a,b,c"_fs, ',');
  *   auto parts = "a,b,c"_fs | split(',');
+ *   auto parts = "a, b;c"_fs | split(str::charset{" ,;"});
  *   auto joined = join(parts, ", ");
+ *   join_into(line, parts, ", ");               // append with exact lengths
+ *
+ * split_result copies each part into a fixed array of MaxParts strings;
+ * to iterate tokens as string_views without copies or a part limit, use
+ * the *_lazy forms in split_view.hpp.
  */
 
 #include "../core/core.hpp"
+#include "../core/simd.hpp"
+#include "charset.hpp"
+#include "concat.hpp"
 #include "pipe.hpp"
 #include <array>
 
@@ -47,6 +56,23 @@ struct split_result {
     }
 };
 
+/**
+ * @brief Runtime split: delimiter bitmasks locate token boundaries and
+ *        each part is filled with one bulk append
+ */
+template <std::size_t MaxParts, meta::character CharT, std::size_t Cap, typename Matcher>
+inline auto split_scan(const basic_fstring<CharT, Cap>& str, const Matcher& matcher) noexcept {
+    split_result<CharT, Cap, MaxParts> result;
+    if constexpr (MaxParts != 0) {
+        detail::simd::for_each_token(str.data(), str.size(), matcher,
+            [&](std::size_t first, std::size_t last) {
+                result.parts[result.count++].append(str.data() + first, last - first);
+                return result.count < MaxParts;
+            });
+    }
+    return result;
+}
+
 // ==================== Split by Character ====================
 
 struct split_char_fn {
@@ -55,6 +81,10 @@ struct split_char_fn {
         const basic_fstring<CharT, Cap>& str, 
         CharT delimiter
     ) const noexcept {
+        if (!std::is_constant_evaluated()) {
+            return split_scan<MaxParts>(str, detail::simd::unit_matcher<CharT>{delimiter});
+        }
+        
         split_result<CharT, Cap, MaxParts> result;
         basic_fstring<CharT, Cap> current;
         
@@ -79,6 +109,30 @@ struct split_char_fn {
         return result;
     }
     
+    // Split on any character of a compiled set; runs of delimiters yield no empty parts
+    template <meta::character CharT, std::size_t Cap, std::size_t MaxParts = 16>
+    [[nodiscard]] constexpr auto operator()(
+        const basic_fstring<CharT, Cap>& str,
+        const charset<CharT>& delimiters
+    ) const noexcept {
+        split_result<CharT, Cap, MaxParts> result;
+        const std::basic_string_view<CharT> sv{str};
+        std::size_t pos = 0;
+        
+        while (result.count < MaxParts) {
+            const std::size_t start = delimiters.find_first_not_of(sv, pos);
+            if (start == sv.npos) break;
+            
+            std::size_t end = delimiters.find_first_of(sv, start);
+            if (end == sv.npos) end = sv.size();
+            
+            result.parts[result.count++].append(sv.data() + start, end - start);
+            pos = end;
+        }
+        
+        return result;
+    }
+    
     // Factory for piping: str | split(',')
     template <meta::character CharT>
     [[nodiscard]] constexpr auto operator()(CharT delimiter) const noexcept {
@@ -86,6 +140,13 @@ struct split_char_fn {
             return (*this)(str, delimiter);
         };
     }
+    
+    template <meta::character CharT>
+    [[nodiscard]] constexpr auto operator()(const charset<CharT>& delimiters) const noexcept {
+        return [delimiters, this](const auto& str) {
+            return (*this)(str, delimiters);
+        };
+    }
 };
 
 inline constexpr split_char_fn split;
@@ -93,10 +154,10 @@ inline constexpr split_char_fn split;
 // ==================== Split by String ====================
 
 struct split_str_fn {
-    template <meta::character CharT, std::size_t Cap, std::size_t DelimCap, std::size_t MaxParts = 16>
+    template <meta::character CharT, std::size_t Cap, std::size_t MaxParts = 16>
     [[nodiscard]] constexpr auto operator()(
         const basic_fstring<CharT, Cap>& str,
-        const basic_fstring<CharT, DelimCap>& delimiter
+        std::type_identity_t<std::basic_string_view<CharT>> delimiter
     ) const noexcept {
         split_result<CharT, Cap, MaxParts> result;
         
@@ -107,31 +168,19 @@ struct split_str_fn {
             return result;
         }
         
+        // Analyse the delimiter once; each part is a single bulk append
+        const detail::substring_searcher<CharT> searcher{delimiter.data(), delimiter.size()};
         std::size_t pos = 0;
         
         while (pos < str.size() && result.count < MaxParts) {
-            std::size_t found = str.find(delimiter.data(), pos);
+            std::size_t found = searcher.find(str.data(), str.size(), pos);
+            const bool last = found == searcher.npos;
+            if (last) found = str.size();
             
-            if (found == basic_fstring<CharT, Cap>::npos) {
-                // No more delimiters, add remaining string
-                basic_fstring<CharT, Cap> part;
-                for (std::size_t i = pos; i < str.size() && !part.full(); ++i) {
-                    part.push_back(str[i]);
-                }
-                if (!part.empty()) {
-                    result.parts[result.count++] = part;
-                }
-                break;
-            }
-            
-            // Add part before delimiter
-            basic_fstring<CharT, Cap> part;
-            for (std::size_t i = pos; i < found && !part.full(); ++i) {
-                part.push_back(str[i]);
-            }
-            if (!part.empty()) {
-                result.parts[result.count++] = part;
+            if (found > pos) {
+                result.parts[result.count++].append(str.data() + pos, found - pos);
             }
+            if (last) break;
             
             pos = found + delimiter.size();
         }
@@ -139,6 +188,14 @@ struct split_str_fn {
         return result;
     }
     
+    template <meta::character CharT, std::size_t Cap, std::size_t DelimCap, std::size_t MaxParts = 16>
+    [[nodiscard]] constexpr auto operator()(
+        const basic_fstring<CharT, Cap>& str,
+        const basic_fstring<CharT, DelimCap>& delimiter
+    ) const noexcept {
+        return operator()<CharT, Cap, MaxParts>(str, std::basic_string_view<CharT>{delimiter});
+    }
+    
     // Factory for piping
     template <meta::character CharT, std::size_t DelimCap>
     [[nodiscard]] constexpr auto operator()(const basic_fstring<CharT, DelimCap>& delimiter) const noexcept {
@@ -147,11 +204,10 @@ struct split_str_fn {
         };
     }
     
-    // C-string overload
+    // C-string overload (length taken once, no intermediate copy)
     template <meta::character CharT>
     [[nodiscard]] constexpr auto operator()(const CharT* delimiter) const noexcept {
-        return [delimiter, this](const auto& str) {
-            basic_fstring<CharT, 64> delim(delimiter);
+        return [delim = std::basic_string_view<CharT>{delimiter}, this](const auto& str) {
             return (*this)(str, delim);
         };
     }
@@ -164,6 +220,10 @@ inline constexpr split_str_fn split_by;
 struct split_lines_fn : pipe_adaptor<split_lines_fn> {
     template <meta::character CharT, std::size_t Cap, std::size_t MaxParts = 16>
     [[nodiscard]] constexpr auto apply(const basic_fstring<CharT, Cap>& str) const noexcept {
+        if (!std::is_constant_evaluated()) {
+            return split_scan<MaxParts>(str, detail::simd::line_matcher<CharT>{});
+        }
+        
         split_result<CharT, Cap, MaxParts> result;
         basic_fstring<CharT, Cap> current;
         
@@ -208,6 +268,10 @@ inline constexpr split_lines_fn split_lines;
 struct split_whitespace_fn : pipe_adaptor<split_whitespace_fn> {
     template <meta::character CharT, std::size_t Cap, std::size_t MaxParts = 16>
     [[nodiscard]] constexpr auto apply(const basic_fstring<CharT, Cap>& str) const noexcept {
+        if (!std::is_constant_evaluated()) {
+            return split_scan<MaxParts>(str, detail::simd::space_matcher<CharT>{});
+        }
+        
         split_result<CharT, Cap, MaxParts> result;
         basic_fstring<CharT, Cap> current;
         
@@ -245,6 +309,9 @@ inline constexpr split_whitespace_fn split_whitespace;
 
 /**
  * @brief Join array of strings with delimiter
+ *
+ * Lengths are summed first and each part is copied once (join_into);
+ * the result capacity covers every part plus a delimiter between each.
  */
 struct join_fn {
     // Join with character delimiter
@@ -253,18 +320,8 @@ struct join_fn {
         const basic_fstring<CharT, Cap> (&parts)[N],
         CharT delimiter
     ) const noexcept {
-        constexpr std::size_t result_cap = Cap * N + N;
-        basic_fstring<CharT, result_cap> result;
-        
-        for (std::size_t i = 0; i < N; ++i) {
-            if (i > 0 && !result.full()) {
-                result.push_back(delimiter);
-            }
-            if (!result.full()) {
-                result.append(parts[i].data(), parts[i].size());
-            }
-        }
-        
+        basic_fstring<CharT, Cap * N + N> result;
+        join_into(result, parts, delimiter);
         return result;
     }
     
@@ -274,18 +331,8 @@ struct join_fn {
         const basic_fstring<CharT, Cap> (&parts)[N],
         const basic_fstring<CharT, DelimCap>& delimiter
     ) const noexcept {
-        constexpr std::size_t result_cap = Cap * N + DelimCap * N;
-        basic_fstring<CharT, result_cap> result;
-        
-        for (std::size_t i = 0; i < N; ++i) {
-            if (i > 0 && !result.full()) {
-                result.append(delimiter.data(), delimiter.size());
-            }
-            if (!result.full()) {
-                result.append(parts[i].data(), parts[i].size());
-            }
-        }
-        
+        basic_fstring<CharT, Cap * N + DelimCap * N> result;
+        join_into(result, parts, delimiter);
         return result;
     }
     
@@ -295,18 +342,8 @@ struct join_fn {
         const split_result<CharT, Cap, MaxParts>& result,
         CharT delimiter
     ) const noexcept {
-        constexpr std::size_t result_cap = Cap * MaxParts + MaxParts;
-        basic_fstring<CharT, result_cap> joined;
-        
-        for (std::size_t i = 0; i < result.count; ++i) {
-            if (i > 0 && !joined.full()) {
-                joined.push_back(delimiter);
-            }
-            if (!joined.full()) {
-                joined.append(result.parts[i].data(), result.parts[i].size());
-            }
-        }
-        
+        basic_fstring<CharT, Cap * MaxParts + MaxParts> joined;
+        join_into(joined, result, delimiter);
         return joined;
     }
     
@@ -316,29 +353,39 @@ struct join_fn {
         const split_result<CharT, Cap, MaxParts>& result,
         const basic_fstring<CharT, DelimCap>& delimiter
     ) const noexcept {
-        constexpr std::size_t result_cap = Cap * MaxParts + DelimCap * MaxParts;
-        basic_fstring<CharT, result_cap> joined;
-        
-        for (std::size_t i = 0; i < result.count; ++i) {
-            if (i > 0 && !joined.full()) {
-                joined.append(delimiter.data(), delimiter.size());
-            }
-            if (!joined.full()) {
-                joined.append(result.parts[i].data(), result.parts[i].size());
-            }
-        }
-        
+        basic_fstring<CharT, Cap * MaxParts + DelimCap * MaxParts> joined;
+        join_into(joined, result, delimiter);
         return joined;
     }
     
-    // Join with C-string delimiter
-    template <meta::character CharT, std::size_t Cap, std::size_t MaxParts>
+    // Join split_result with an array delimiter: a literal, or a buffer
+    // filled at runtime. The text ends at the first null; N - 1 only
+    // bounds the capacity
+    template <meta::character CharT, std::size_t Cap, std::size_t MaxParts, std::size_t N>
     [[nodiscard]] constexpr auto operator()(
         const split_result<CharT, Cap, MaxParts>& result,
-        const CharT* delimiter
+        const CharT (&delimiter)[N]
     ) const noexcept {
-        basic_fstring<CharT, 64> delim(delimiter);
-        return (*this)(result, delim);
+        basic_fstring<CharT, Cap * MaxParts + (N - 1) * MaxParts> joined;
+        const std::size_t len = std::char_traits<CharT>::length(delimiter);
+        join_into(joined, result, std::basic_string_view<CharT>{delimiter, len});
+        return joined;
+    }
+    
+    // Join with C-string delimiter. A runtime pointer's length is not known
+    // at compile time, so the capacity reserves 64 units per delimiter on
+    // top of the parts. A result that does not fit is truncated at capacity
+    // like any append; call join_into directly to detect that (it returns
+    // the length needed) or to join into an exactly sized target.
+    template <meta::character CharT, std::size_t Cap, std::size_t MaxParts, typename Ptr>
+    requires std::is_pointer_v<Ptr> && std::is_convertible_v<Ptr, const CharT*>
+    [[nodiscard]] constexpr auto operator()(
+        const split_result<CharT, Cap, MaxParts>& result,
+        Ptr delimiter
+    ) const noexcept {
+        basic_fstring<CharT, Cap * MaxParts + 64 * MaxParts> joined;
+        join_into(joined, result, std::basic_string_view<CharT>{delimiter});
+        return joined;
     }
 };
 
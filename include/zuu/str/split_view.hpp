@@ -0,0 +1,379 @@
+#pragma once
+
+/**
+ * @file zuu/str/split_view.hpp
+ * @brief Lazy, zero-copy split views yielding string_views
+ * @version 3.0.0
+ *
+ * Design Philosophy:
+ * - Tokens are found on demand and returned as views into the source:
+ *   no copies, no stack reservation, no MaxParts limit
+ * - Same token rules as the eager split family: empty tokens are skipped
+ * - Lvalue sources are viewed; rvalue strings (e.g. a temporary fstring)
+ *   are moved into the view so range-for over a temporary is safe
+ *
+ * Usage:
+ *   for (std::string_view field : line | split_lazy(',')) { ... }
+ *   for (auto word : text | split_whitespace_lazy) { ... }
+ *   auto last = *(path | rsplit_lazy('/')).begin();     // right to left
+ *   auto n = std::ranges::distance(csv | split_by_lazy(", "));
+ */
+
+#include "../core/core.hpp"
+#include "../core/search.hpp"
+#include "../core/simd.hpp"
+#include "charset.hpp"
+#include "pipe.hpp"
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace zuu::detail {
+
+// ==================== Split Delimiters ====================
+
+/*
+ * A delimiter policy exposes `char_type`, `reverse`, and
+ * `next(sv, pos) -> split_token`, which returns the next non-empty token
+ * at or after `pos` (at or before, for reverse policies) with `first`
+ * set to npos when none is left. `resume` is where the following search
+ * starts.
+ */
+
+struct split_token {
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    std::size_t first = npos;
+    std::size_t last = npos;
+    std::size_t resume = 0;
+};
+
+template <meta::character CharT>
+struct char_delimiter {
+    using char_type = CharT;
+    static constexpr bool reverse = false;
+
+    CharT delim;
+
+    constexpr split_token next(std::basic_string_view<CharT> sv, std::size_t pos) const noexcept {
+        const std::size_t n = sv.size();
+        while (pos < n && sv[pos] == delim) ++pos;
+        if (pos >= n) return {};
+
+        std::size_t end = n;
+        if (!std::is_constant_evaluated()) {
+            end = pos + simd::find_char(sv.data() + pos, n - pos, delim);
+        } else {
+            end = pos;
+            while (end < n && sv[end] != delim) ++end;
+        }
+        return {pos, end, end};
+    }
+};
+
+template <meta::character CharT>
+struct charset_delimiter {
+    using char_type = CharT;
+    static constexpr bool reverse = false;
+
+    str::charset<CharT> set;
+
+    constexpr split_token next(std::basic_string_view<CharT> sv, std::size_t pos) const noexcept {
+        const std::size_t first = set.find_first_not_of(sv, pos);
+        if (first == sv.npos) return {};
+
+        std::size_t last = set.find_first_of(sv, first);
+        if (last == sv.npos) last = sv.size();
+        return {first, last, last};
+    }
+};
+
+// The delimiter text is referenced, not copied, and must outlive the view
+template <meta::character CharT>
+struct string_delimiter {
+    using char_type = CharT;
+    static constexpr bool reverse = false;
+
+    substring_searcher<CharT> searcher;
+    std::size_t length;
+
+    constexpr explicit string_delimiter(std::basic_string_view<CharT> delim) noexcept
+        : searcher{delim.data(), delim.size()}, length{delim.size()} {}
+
+    constexpr split_token next(std::basic_string_view<CharT> sv, std::size_t pos) const noexcept {
+        const std::size_t n = sv.size();
+
+        // An empty delimiter yields the whole string as a single token
+        if (length == 0) return pos == 0 && n != 0 ? split_token{0, n, n} : split_token{};
+
+        while (pos < n) {
+            const std::size_t found = searcher.find(sv.data(), n, pos);
+            if (found == searcher.npos) return {pos, n, n};
+            if (found > pos) return {pos, found, found + length};
+            pos = found + length;
+        }
+        return {};
+    }
+};
+
+// Scans right to left; `pos` is one past the last unit still to visit
+template <meta::character CharT>
+struct reverse_char_delimiter {
+    using char_type = CharT;
+    static constexpr bool reverse = true;
+
+    CharT delim;
+
+    constexpr split_token next(std::basic_string_view<CharT> sv, std::size_t pos) const noexcept {
+        while (pos > 0 && sv[pos - 1] == delim) --pos;
+        if (pos == 0) return {};
+
+        std::size_t first = 0;
+        if (!std::is_constant_evaluated()) {
+            const std::size_t idx = simd::rfind_char(sv.data(), pos, delim);
+            first = idx == pos ? 0 : idx + 1;
+        } else {
+            first = pos;
+            while (first > 0 && sv[first - 1] != delim) --first;
+        }
+        return {first, pos, first};
+    }
+};
+
+} // namespace zuu::detail
+
+namespace zuu::str {
+
+// ==================== Split View ====================
+
+/**
+ * @brief Forward range over the tokens of `Source` split by `Delimiter`
+ *
+ * `Source` is a string_view for borrowed input or an owned string type
+ * for rvalue input. Iterators refer to the view, so keep the view alive
+ * while iterating; the tokens themselves point into the source text.
+ */
+template <typename Source, typename Delimiter>
+class split_view : public std::ranges::view_interface<split_view<Source, Delimiter>> {
+public:
+    using char_type = typename Delimiter::char_type;
+    using value_type = std::basic_string_view<char_type>;
+    using size_type = std::size_t;
+
+private:
+    Source source_;
+    Delimiter delim_;
+
+    constexpr value_type text() const noexcept {
+        return value_type{std::data(source_), std::size(source_)};
+    }
+
+public:
+    class iterator {
+        const split_view* parent_ = nullptr;
+        detail::split_token token_;
+
+        friend class split_view;
+
+        constexpr iterator(const split_view* parent, detail::split_token token) noexcept
+            : parent_{parent}, token_{token} {}
+
+    public:
+        using value_type = std::basic_string_view<char_type>;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+
+        constexpr iterator() noexcept = default;
+
+        [[nodiscard]] constexpr value_type operator*() const noexcept {
+            return parent_->text().substr(token_.first, token_.last - token_.first);
+        }
+
+        // Offset of the current token within the source
+        [[nodiscard]] constexpr size_type position() const noexcept { return token_.first; }
+
+        constexpr iterator& operator++() noexcept {
+            token_ = parent_->delim_.next(parent_->text(), token_.resume);
+            return *this;
+        }
+
+        constexpr iterator operator++(int) noexcept {
+            iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(const iterator& a, const iterator& b) noexcept {
+            return a.token_.first == b.token_.first;
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(const iterator& it, std::default_sentinel_t) noexcept {
+            return it.token_.first == detail::split_token::npos;
+        }
+    };
+
+    constexpr split_view() = default;
+
+    constexpr split_view(Source source, Delimiter delim)
+        noexcept(std::is_nothrow_move_constructible_v<Source>)
+        : source_{std::move(source)}, delim_{std::move(delim)} {}
+
+    [[nodiscard]] constexpr iterator begin() const noexcept {
+        const value_type sv = text();
+        return iterator{this, delim_.next(sv, Delimiter::reverse ? sv.size() : 0)};
+    }
+
+    [[nodiscard]] constexpr std::default_sentinel_t end() const noexcept { return {}; }
+
+    // The text being split
+    [[nodiscard]] constexpr value_type base() const noexcept { return text(); }
+};
+
+// ==================== Source Adoption ====================
+
+/**
+ * @brief Borrow lvalues and views; take ownership of other rvalues
+ */
+template <typename Str>
+using split_char_t = meta::char_type_of_t<std::decay_t<Str>>;
+
+template <typename Str>
+using split_source_t = std::conditional_t<
+    std::is_lvalue_reference_v<Str> ||
+    std::is_pointer_v<std::decay_t<Str>> ||
+    std::is_same_v<std::remove_cvref_t<Str>, std::basic_string_view<split_char_t<Str>>>,
+    std::basic_string_view<split_char_t<Str>>,
+    std::remove_cvref_t<Str>>;
+
+template <typename Delimiter, meta::string_like Str>
+[[nodiscard]] constexpr auto make_split_view(Str&& str, Delimiter delim) {
+    using source = split_source_t<Str>;
+    if constexpr (std::is_same_v<source, std::basic_string_view<split_char_t<Str>>>) {
+        return split_view<source, Delimiter>{source{str}, std::move(delim)};
+    } else {
+        return split_view<source, Delimiter>{std::forward<Str>(str), std::move(delim)};
+    }
+}
+
+// ==================== Split by Character / Charset ====================
+
+struct split_lazy_fn {
+    template <meta::string_like Str>
+    [[nodiscard]] constexpr auto operator()(Str&& str, split_char_t<Str> delimiter) const {
+        return make_split_view(std::forward<Str>(str), detail::char_delimiter<split_char_t<Str>>{delimiter});
+    }
+
+    template <meta::string_like Str>
+    [[nodiscard]] constexpr auto operator()(Str&& str, const charset<split_char_t<Str>>& delimiters) const {
+        return make_split_view(std::forward<Str>(str), detail::charset_delimiter<split_char_t<Str>>{delimiters});
+    }
+
+    // Factories for piping: str | split_lazy(',')
+    template <meta::character CharT>
+    [[nodiscard]] constexpr auto operator()(CharT delimiter) const noexcept {
+        return [delimiter, this](auto&& str) {
+            return (*this)(std::forward<decltype(str)>(str), delimiter);
+        };
+    }
+
+    template <meta::character CharT>
+    [[nodiscard]] constexpr auto operator()(const charset<CharT>& delimiters) const noexcept {
+        return [delimiters, this](auto&& str) {
+            return (*this)(std::forward<decltype(str)>(str), delimiters);
+        };
+    }
+};
+
+inline constexpr split_lazy_fn split_lazy;
+
+// ==================== Split by String ====================
+
+struct split_by_lazy_fn {
+    // The delimiter is referenced by the view and must outlive it
+    template <meta::string_like Str>
+    [[nodiscard]] constexpr auto operator()(
+        Str&& str,
+        std::type_identity_t<std::basic_string_view<split_char_t<Str>>> delimiter
+    ) const {
+        return make_split_view(std::forward<Str>(str), detail::string_delimiter<split_char_t<Str>>{delimiter});
+    }
+
+    // Factories for piping: str | split_by_lazy(", ")
+    template <meta::character CharT>
+    [[nodiscard]] constexpr auto operator()(const CharT* delimiter) const noexcept {
+        return [delim = std::basic_string_view<CharT>{delimiter}, this](auto&& str) {
+            return (*this)(std::forward<decltype(str)>(str), delim);
+        };
+    }
+
+    template <meta::character CharT, std::size_t DelimCap>
+    [[nodiscard]] constexpr auto operator()(const basic_fstring<CharT, DelimCap>& delimiter) const noexcept {
+        return [delim = std::basic_string_view<CharT>{delimiter}, this](auto&& str) {
+            return (*this)(std::forward<decltype(str)>(str), delim);
+        };
+    }
+
+    // A temporary delimiter would dangle inside the view
+    template <meta::character CharT, std::size_t DelimCap>
+    void operator()(basic_fstring<CharT, DelimCap>&&) const = delete;
+};
+
+inline constexpr split_by_lazy_fn split_by_lazy;
+
+// ==================== Split Lines / Whitespace ====================
+
+/*
+ * Empty tokens are skipped, so treating '\r' and '\n' as independent
+ * delimiters handles \n, \r and \r\n line endings alike.
+ */
+struct split_lines_lazy_fn : pipe_adaptor<split_lines_lazy_fn> {
+    template <meta::string_like Str>
+    [[nodiscard]] constexpr auto apply(Str&& str) const {
+        using CharT = split_char_t<Str>;
+        constexpr CharT breaks[] = {CharT('\r'), CharT('\n'), CharT()};
+        return make_split_view(std::forward<Str>(str), detail::charset_delimiter<CharT>{charset<CharT>{breaks}});
+    }
+};
+
+inline constexpr split_lines_lazy_fn split_lines_lazy;
+
+struct split_whitespace_lazy_fn : pipe_adaptor<split_whitespace_lazy_fn> {
+    template <meta::string_like Str>
+    [[nodiscard]] constexpr auto apply(Str&& str) const {
+        using CharT = split_char_t<Str>;
+        constexpr CharT spaces[] = {
+            CharT(' '), CharT('\t'), CharT('\n'), CharT('\r'), CharT('\f'), CharT('\v'), CharT()
+        };
+        return make_split_view(std::forward<Str>(str), detail::charset_delimiter<CharT>{charset<CharT>{spaces}});
+    }
+};
+
+inline constexpr split_whitespace_lazy_fn split_whitespace_lazy;
+
+// ==================== Reverse Split ====================
+
+/**
+ * @brief Tokens from right to left: "a/b/c" yields "c", "b", "a"
+ */
+struct rsplit_lazy_fn {
+    template <meta::string_like Str>
+    [[nodiscard]] constexpr auto operator()(Str&& str, split_char_t<Str> delimiter) const {
+        return make_split_view(std::forward<Str>(str), detail::reverse_char_delimiter<split_char_t<Str>>{delimiter});
+    }
+
+    // Factory for piping
+    template <meta::character CharT>
+    [[nodiscard]] constexpr auto operator()(CharT delimiter) const noexcept {
+        return [delimiter, this](auto&& str) {
+            return (*this)(std::forward<decltype(str)>(str), delimiter);
+        };
+    }
+};
+
+inline constexpr rsplit_lazy_fn rsplit_lazy;
+
+} // namespace zuu::str
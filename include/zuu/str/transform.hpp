@@ -0,0 +1,97 @@
+#pragma once
+
+/**
+ * @file zuu/str/transform.hpp
+ * @brief Character replace, filter and substring stages
+ * @version 3.0.0
+ *
+ * Each stage works alone (one pass, same capacity as an fstring input)
+ * and fuses with trim and the case conversions when composed.
+ *
+ * Usage:
+ *   auto slug = title | (trim | to_lower | replace_char(' ', '-'));
+ *   auto digits = phone | filter([](char c) { return c >= '0' && c <= '9'; });
+ *   auto bare = id | erase_char('-');
+ *   auto head = line | substr(0, 8);
+ */
+
+#include "../core/core.hpp"
+#include "fuse.hpp"
+#include <cstddef>
+#include <string_view>
+#include <utility>
+
+namespace zuu::str {
+
+// ==================== Replace ====================
+
+template <meta::character CharT>
+struct replace_char_fn : fusable_adaptor<replace_char_fn<CharT>> {
+    CharT from;
+    CharT to;
+
+    constexpr replace_char_fn(CharT f, CharT t) noexcept : from{f}, to{t} {}
+
+    constexpr CharT map(CharT ch) const noexcept { return ch == from ? to : ch; }
+};
+
+// Replace every `from` with `to`
+template <meta::character CharT>
+constexpr auto replace_char(CharT from, CharT to) noexcept {
+    return replace_char_fn<CharT>{from, to};
+}
+
+// ==================== Erase / Filter ====================
+
+template <meta::character CharT>
+struct erase_char_fn : fusable_adaptor<erase_char_fn<CharT>> {
+    CharT target;
+
+    constexpr explicit erase_char_fn(CharT t) noexcept : target{t} {}
+
+    constexpr bool keep(CharT ch) const noexcept { return ch != target; }
+};
+
+// Drop every occurrence of `ch`
+template <meta::character CharT>
+constexpr auto erase_char(CharT ch) noexcept {
+    return erase_char_fn<CharT>{ch};
+}
+
+template <typename Pred>
+struct filter_fn : fusable_adaptor<filter_fn<Pred>> {
+    Pred predicate;
+
+    constexpr explicit filter_fn(Pred p) : predicate{std::move(p)} {}
+
+    template <meta::character CharT>
+    constexpr bool keep(CharT ch) const noexcept { return static_cast<bool>(predicate(ch)); }
+};
+
+// Keep only the characters `pred` accepts (a callable or a str::charset)
+template <typename Pred>
+constexpr auto filter(Pred&& pred) {
+    return filter_fn<std::decay_t<Pred>>{std::forward<Pred>(pred)};
+}
+
+// ==================== Substring ====================
+
+struct substr_fn : fusable_adaptor<substr_fn> {
+    std::size_t pos;
+    std::size_t count;
+
+    constexpr substr_fn(std::size_t p, std::size_t n) noexcept : pos{p}, count{n} {}
+
+    // Clamped like basic_fstring::substr: a start past the end gives ""
+    template <meta::character CharT>
+    constexpr std::basic_string_view<CharT> narrow(std::basic_string_view<CharT> sv) const noexcept {
+        return pos < sv.size() ? sv.substr(pos, count) : sv.substr(sv.size());
+    }
+};
+
+// Characters [pos, pos + count) of the input
+constexpr auto substr(std::size_t pos, std::size_t count = std::string_view::npos) noexcept {
+    return substr_fn{pos, count};
+}
+
+} // namespace zuu::str
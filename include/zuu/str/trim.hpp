@@ -9,11 +9,30 @@
  *   auto result = trim(str);           // Traditional
  *   auto result = str | trim;           // Piped
  *   auto result = str | trim_left;      // Left only
+ *   auto result = str | trim_if(str::charset{"-_"});
+ *   auto bounds = line | trim_view;    // string_view into `line`, no copy
+ *   auto core   = line | trim_if_view(std::cref(delims));
+ *
+ * Every trim is a narrowing stage (fuse.hpp): inside a composed pipeline
+ * it only moves the ends of the view. Results are one copy of the kept
+ * range; trim_inplace(s) and `s |= trim_if(...)` shift it to the front of
+ * `s` itself, and rvalue inputs are trimmed in their own storage.
+ *
+ * The _view forms copy nothing: they return the kept range of the
+ * argument, whatever its length (the copying forms give non-fixed inputs
+ * an fstring<256>). At runtime the whitespace runs at either end are
+ * scanned a vector at a time, so trimming is two pointer adjustments.
+ * trim_if takes a charset by value or, to share a precomputed one, as
+ * std::cref(set).
  */
 
 #include "../core/core.hpp"
+#include "charset.hpp"
+#include "fuse.hpp"
 #include "pipe.hpp"
+#include <functional>
 #include <string_view>
+#include <type_traits>
 
 namespace zuu::str {
 
@@ -28,6 +47,11 @@ constexpr bool is_space(CharT ch) noexcept {
 
 template <meta::character CharT>
 constexpr std::size_t find_first_non_space(std::basic_string_view<CharT> sv) noexcept {
+    if (!std::is_constant_evaluated()) {
+        // Most inputs have no leading space; the first unit settles those
+        if (sv.empty() || !is_space(sv.front())) return 0;
+        return detail::simd::find_not_space(sv.data(), sv.size());
+    }
     for (std::size_t i = 0; i < sv.size(); ++i) {
         if (!is_space(sv[i])) return i;
     }
@@ -36,6 +60,11 @@ constexpr std::size_t find_first_non_space(std::basic_string_view<CharT> sv) noe
 
 template <meta::character CharT>
 constexpr std::size_t find_last_non_space(std::basic_string_view<CharT> sv) noexcept {
+    if (!std::is_constant_evaluated()) {
+        if (sv.empty() || !is_space(sv.back())) return sv.size();
+        const std::size_t last = detail::simd::rfind_not_space(sv.data(), sv.size());
+        return last == sv.size() ? 0 : last + 1;
+    }
     for (std::size_t i = sv.size(); i > 0; --i) {
         if (!is_space(sv[i - 1])) return i;
     }
@@ -44,144 +73,76 @@ constexpr std::size_t find_last_non_space(std::basic_string_view<CharT> sv) noex
 
 // ==================== Trim Left ====================
 
-struct trim_left_fn : view_pipe<trim_left_fn> {
+struct trim_left_fn : fusable_adaptor<trim_left_fn> {
     template <meta::character CharT>
-    constexpr auto apply(std::basic_string_view<CharT> sv) const noexcept {
-        const auto start = find_first_non_space(sv);
-        
-        // Return same capacity fstring
-        constexpr std::size_t result_cap = 256; // Default, will be optimized
-        basic_fstring<CharT, result_cap> result;
-        
-        if (start < sv.size()) {
-            const auto trimmed = sv.substr(start);
-            result.append(trimmed.data(), trimmed.size());
-        }
-        
-        return result;
-    }
-
-    // Overload for fixed-capacity strings (preserve capacity)
-    template <meta::character CharT, std::size_t Cap>
-    constexpr auto apply(const basic_fstring<CharT, Cap>& str) const noexcept {
-        std::basic_string_view<CharT> sv{str.data(), str.size()};
-        const auto start = find_first_non_space(sv);
-        
-        basic_fstring<CharT, Cap> result;
-        if (start < sv.size()) {
-            const auto trimmed = sv.substr(start);
-            result.append(trimmed.data(), trimmed.size());
-        }
-        
-        return result;
+    static constexpr std::basic_string_view<CharT> narrow(std::basic_string_view<CharT> sv) noexcept {
+        return sv.substr(find_first_non_space(sv));
     }
 };
 
 inline constexpr trim_left_fn trim_left;
+inline constexpr inplace_fn<trim_left_fn> trim_left_inplace;
+inline constexpr view_fn<trim_left_fn> trim_left_view;
 
 // ==================== Trim Right ====================
 
-struct trim_right_fn : view_pipe<trim_right_fn> {
+struct trim_right_fn : fusable_adaptor<trim_right_fn> {
     template <meta::character CharT>
-    constexpr auto apply(std::basic_string_view<CharT> sv) const noexcept {
-        const auto end = find_last_non_space(sv);
-        
-        constexpr std::size_t result_cap = 256;
-        basic_fstring<CharT, result_cap> result;
-        
-        if (end > 0) {
-            const auto trimmed = sv.substr(0, end);
-            result.append(trimmed.data(), trimmed.size());
-        }
-        
-        return result;
-    }
-
-    template <meta::character CharT, std::size_t Cap>
-    constexpr auto apply(const basic_fstring<CharT, Cap>& str) const noexcept {
-        std::basic_string_view<CharT> sv{str.data(), str.size()};
-        const auto end = find_last_non_space(sv);
-        
-        basic_fstring<CharT, Cap> result;
-        if (end > 0) {
-            const auto trimmed = sv.substr(0, end);
-            result.append(trimmed.data(), trimmed.size());
-        }
-        
-        return result;
+    static constexpr std::basic_string_view<CharT> narrow(std::basic_string_view<CharT> sv) noexcept {
+        return sv.substr(0, find_last_non_space(sv));
     }
 };
 
 inline constexpr trim_right_fn trim_right;
+inline constexpr inplace_fn<trim_right_fn> trim_right_inplace;
+inline constexpr view_fn<trim_right_fn> trim_right_view;
 
 // ==================== Trim Both ====================
 
-struct trim_fn : view_pipe<trim_fn> {
+struct trim_fn : fusable_adaptor<trim_fn> {
     template <meta::character CharT>
-    constexpr auto apply(std::basic_string_view<CharT> sv) const noexcept {
+    static constexpr std::basic_string_view<CharT> narrow(std::basic_string_view<CharT> sv) noexcept {
         const auto start = find_first_non_space(sv);
         const auto end = find_last_non_space(sv);
-        
-        constexpr std::size_t result_cap = 256;
-        basic_fstring<CharT, result_cap> result;
-        
-        if (start < end) {
-            const auto trimmed = sv.substr(start, end - start);
-            result.append(trimmed.data(), trimmed.size());
-        }
-        
-        return result;
-    }
-
-    template <meta::character CharT, std::size_t Cap>
-    constexpr auto apply(const basic_fstring<CharT, Cap>& str) const noexcept {
-        std::basic_string_view<CharT> sv{str.data(), str.size()};
-        const auto start = find_first_non_space(sv);
-        const auto end = find_last_non_space(sv);
-        
-        basic_fstring<CharT, Cap> result;
-        if (start < end) {
-            const auto trimmed = sv.substr(start, end - start);
-            result.append(trimmed.data(), trimmed.size());
-        }
-        
-        return result;
+        return start < end ? sv.substr(start, end - start) : sv.substr(0, 0);
     }
 };
 
 inline constexpr trim_fn trim;
+inline constexpr inplace_fn<trim_fn> trim_inplace;
+inline constexpr view_fn<trim_fn> trim_view;
 
 // ==================== Custom Predicate Trim ====================
 
+// Pred may be std::reference_wrapper, e.g. std::cref of a static charset
 template <typename Pred>
-struct trim_if_fn {
+struct trim_if_fn : fusable_adaptor<trim_if_fn<Pred>> {
+    using predicate_type = std::remove_cvref_t<std::unwrap_reference_t<Pred>>;
+
     Pred predicate;
 
     constexpr trim_if_fn(Pred p) : predicate{std::move(p)} {}
 
-    template <meta::character CharT, std::size_t Cap>
-    constexpr auto operator()(const basic_fstring<CharT, Cap>& str) const noexcept {
-        std::basic_string_view<CharT> sv{str.data(), str.size()};
-        
+    template <meta::character CharT>
+    constexpr std::basic_string_view<CharT> narrow(std::basic_string_view<CharT> sv) const noexcept {
+        const predicate_type& pred = predicate;
         std::size_t start = 0;
-        while (start < sv.size() && predicate(sv[start])) ++start;
-        
         std::size_t end = sv.size();
-        while (end > start && predicate(sv[end - 1])) --end;
         
-        basic_fstring<CharT, Cap> result;
-        if (start < end) {
-            const auto trimmed = sv.substr(start, end - start);
-            result.append(trimmed.data(), trimmed.size());
+        if constexpr (is_charset_v<predicate_type>) {
+            // Compiled set: both edges are vector class scans
+            start = pred.find_first_not_of(sv);
+            if (start == sv.npos) start = sv.size();
+            const std::size_t last = pred.find_last_not_of(sv);
+            end = last == sv.npos ? start : last + 1;
+        } else {
+            while (start < sv.size() && pred(sv[start])) ++start;
+            while (end > start && pred(sv[end - 1])) --end;
         }
         
-        return result;
+        return sv.substr(start, end - start);
     }
 
-    template <meta::string_like Str>
-    friend constexpr auto operator|(Str&& str, const trim_if_fn& t) {
-        return t(std::forward<Str>(str));
-    }
 };
 
 // Factory function for custom trim
@@ -190,4 +151,10 @@ constexpr auto trim_if(Pred&& pred) {
     return trim_if_fn{std::forward<Pred>(pred)};
 }
 
+// Zero-copy form: trim_if_view(set)(line) is a view into `line`
+template <typename Pred>
+constexpr auto trim_if_view(Pred&& pred) {
+    return view_fn<trim_if_fn<std::decay_t<Pred>>>{trim_if_fn{std::forward<Pred>(pred)}};
+}
+
 } // namespace zuu::str
\ No newline at end of file
@@ -0,0 +1,418 @@
+#pragma once
+
+/**
+ * @file zuu/str/unicode_case.hpp
+ * @brief Unicode simple case mapping and case folding with pipe support
+ * @version 3.0.0
+ *
+ * Design Philosophy:
+ * - Code units are decoded by width: 1 byte is UTF-8, 2 bytes UTF-16,
+ *   4 bytes UTF-32 (so wchar_t follows the platform)
+ * - Mappings are the UCD simple (1:1 code point) ones and simple case
+ *   folding (CaseFolding.txt status C and S), looked up in the two-stage
+ *   tables of unicode_case_tables.hpp, generated by
+ *   tools/gen_case_tables.py
+ * - A mapping may change the encoded length ("Ⱥ" is 2 bytes, "ⱥ" is 3):
+ *   results keep the input's capacity and are cut before the first code
+ *   point that does not fit, never inside one; `into` reports the
+ *   length the whole result needed
+ * - Malformed units (stray surrogates, invalid UTF-8) are copied through
+ *   unchanged and compare only with themselves
+ * - At runtime, lower/upper/fold hand all-ASCII strings to
+ *   ascii_case_convert and, in mixed text, each ASCII run of a vector
+ *   or more to ascii_case_prefix, decoding only the rest; title case and
+ *   constant evaluation decode throughout
+ *
+ * The ASCII-only str::to_lower family stays as it is: fusable, and the
+ * right choice for protocol text.
+ *
+ * Usage:
+ *   u8fstring<64> name = u8"ÉMILE Ⅻ";
+ *   auto lower = name | unicode::to_lower;                 // u8"émile ⅻ"
+ *   auto key = name | unicode::fold_case;                  // caseless key
+ *   bool same = unicode::equals_ignore_case(name, u8"émile ⅻ");
+ *   auto needed = unicode::to_upper.into(out, name);       // snprintf-style
+ */
+
+#include "../core/core.hpp"
+#include "../core/simd.hpp"
+#include "concat.hpp"
+#include "pipe.hpp"
+#include "unicode_case_tables.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace zuu::detail::unicode_case {
+
+// ==================== Lookup ====================
+
+[[nodiscard]] constexpr const record& lookup(char32_t cp) noexcept {
+    if (cp >= limit) return records[0];
+    const std::size_t block = stage1[cp >> shift];
+    return records[stage2[(block << shift) | (cp & ((1u << shift) - 1))]];
+}
+
+enum class op { lower, upper, title, fold };
+
+template <op Op>
+[[nodiscard]] constexpr char32_t map(char32_t cp) noexcept {
+    const record& r = lookup(cp);
+    std::int32_t delta;
+    if constexpr (Op == op::lower) delta = r.lower;
+    else if constexpr (Op == op::upper) delta = r.upper;
+    else if constexpr (Op == op::title) delta = r.title;
+    else delta = r.fold;
+    return static_cast<char32_t>(static_cast<std::int32_t>(cp) + delta);
+}
+
+// The ASCII kernel doing Op's work: folding is lowercasing there, and
+// title case is uppercase
+template <op Op>
+inline constexpr auto ascii_op =
+    Op == op::upper || Op == op::title ? simd::ascii_case::upper : simd::ascii_case::lower;
+
+// Unicode White_Space: title case starts a word after any of these
+[[nodiscard]] constexpr bool is_white_space(char32_t cp) noexcept {
+    if (cp < 0x80) return cp == 0x20 || (cp >= 0x09 && cp <= 0x0D);
+    return cp == 0x85 || cp == 0xA0 || cp == 0x1680 || (cp >= 0x2000 && cp <= 0x200A) ||
+           cp == 0x2028 || cp == 0x2029 || cp == 0x202F || cp == 0x205F || cp == 0x3000;
+}
+
+// ==================== Encoding ====================
+
+// A malformed unit decodes to raw_base + unit: no scalar value equals it,
+// no mapping touches it, and encode writes the unit back
+inline constexpr char32_t raw_base = 0x110000;
+
+struct decoded {
+    char32_t cp;
+    unsigned len;
+};
+
+/**
+ * @brief Decode the code point at p[0] (n > 0 units available)
+ *
+ * UTF-8 is strict (Unicode Table 3-7): overlong forms, surrogates and
+ * values past U+10FFFF are malformed, one unit at a time.
+ */
+template <meta::character CharT>
+[[nodiscard]] constexpr decoded decode(const CharT* p, std::size_t n) noexcept {
+    using U = std::make_unsigned_t<CharT>;
+    const char32_t c0 = static_cast<U>(p[0]);
+
+    if constexpr (sizeof(CharT) == 1) {
+        if (c0 < 0x80) return {c0, 1};
+
+        unsigned len;
+        char32_t cp;
+        char32_t lo = 0x80, hi = 0xBF;  // range of the second byte
+        if (c0 >= 0xC2 && c0 <= 0xDF) {
+            len = 2;
+            cp = c0 & 0x1F;
+        } else if (c0 >= 0xE0 && c0 <= 0xEF) {
+            len = 3;
+            cp = c0 & 0x0F;
+            if (c0 == 0xE0) lo = 0xA0;
+            if (c0 == 0xED) hi = 0x9F;
+        } else if (c0 >= 0xF0 && c0 <= 0xF4) {
+            len = 4;
+            cp = c0 & 0x07;
+            if (c0 == 0xF0) lo = 0x90;
+            if (c0 == 0xF4) hi = 0x8F;
+        } else {
+            return {raw_base + c0, 1};
+        }
+        if (n < len) return {raw_base + c0, 1};
+
+        for (unsigned k = 1; k < len; ++k) {
+            const char32_t c = static_cast<U>(p[k]);
+            if (c < lo || c > hi) return {raw_base + c0, 1};
+            lo = 0x80;
+            hi = 0xBF;
+            cp = (cp << 6) | (c & 0x3F);
+        }
+        return {cp, len};
+    } else if constexpr (sizeof(CharT) == 2) {
+        if (c0 - 0xD800u >= 0x800u) return {c0, 1};
+        if (c0 < 0xDC00 && n >= 2) {
+            const char32_t c1 = static_cast<U>(p[1]);
+            if (c1 - 0xDC00u < 0x400u) return {0x10000 + ((c0 - 0xD800) << 10) + (c1 - 0xDC00), 2};
+        }
+        return {raw_base + c0, 1};
+    } else {
+        // Out-of-range values and surrogates have no mapping and are
+        // written back as they are
+        return {c0, 1};
+    }
+}
+
+template <meta::character CharT>
+[[nodiscard]] constexpr unsigned encoded_length(char32_t cp) noexcept {
+    if constexpr (sizeof(CharT) == 1) {
+        if (cp >= raw_base) return 1;
+        return cp < 0x80 ? 1 : cp < 0x800 ? 2 : cp < 0x10000 ? 3 : 4;
+    } else if constexpr (sizeof(CharT) == 2) {
+        return cp >= 0x10000 && cp < raw_base ? 2 : 1;
+    } else {
+        return 1;
+    }
+}
+
+template <meta::character CharT>
+constexpr void encode(char32_t cp, CharT* out) noexcept {
+    if constexpr (sizeof(CharT) == 1) {
+        if (cp < 0x80 || cp >= raw_base) {
+            out[0] = static_cast<CharT>(cp < 0x80 ? cp : cp - raw_base);
+        } else if (cp < 0x800) {
+            out[0] = static_cast<CharT>(0xC0 | (cp >> 6));
+            out[1] = static_cast<CharT>(0x80 | (cp & 0x3F));
+        } else if (cp < 0x10000) {
+            out[0] = static_cast<CharT>(0xE0 | (cp >> 12));
+            out[1] = static_cast<CharT>(0x80 | ((cp >> 6) & 0x3F));
+            out[2] = static_cast<CharT>(0x80 | (cp & 0x3F));
+        } else {
+            out[0] = static_cast<CharT>(0xF0 | (cp >> 18));
+            out[1] = static_cast<CharT>(0x80 | ((cp >> 12) & 0x3F));
+            out[2] = static_cast<CharT>(0x80 | ((cp >> 6) & 0x3F));
+            out[3] = static_cast<CharT>(0x80 | (cp & 0x3F));
+        }
+    } else if constexpr (sizeof(CharT) == 2) {
+        if (cp >= raw_base) {
+            out[0] = static_cast<CharT>(cp - raw_base);
+        } else if (cp < 0x10000) {
+            out[0] = static_cast<CharT>(cp);
+        } else {
+            out[0] = static_cast<CharT>(0xD800 + ((cp - 0x10000) >> 10));
+            out[1] = static_cast<CharT>(0xDC00 + ((cp - 0x10000) & 0x3FF));
+        }
+    } else {
+        out[0] = static_cast<CharT>(cp);
+    }
+}
+
+// Units that never start a code point: a greedy decode always has a
+// boundary before every other unit
+template <meta::character CharT>
+[[nodiscard]] constexpr bool is_trail(CharT ch) noexcept {
+    using U = std::make_unsigned_t<CharT>;
+    const auto u = static_cast<U>(ch);
+    if constexpr (sizeof(CharT) == 1) return (u & 0xC0u) == 0x80u;
+    else if constexpr (sizeof(CharT) == 2) return u - 0xDC00u < 0x400u;
+    else return false;
+}
+
+// ==================== Conversion ====================
+
+// Op applied to one decoded code point; title case needs the previous
+// one. ASCII takes the table too: a branch on it mispredicts on mixed
+// text, and its rows stay in L1
+template <op Op>
+constexpr char32_t map_one(char32_t cp, bool& word_start) noexcept {
+    if constexpr (Op == op::title) {
+        const char32_t out = word_start ? map<op::title>(cp) : map<op::lower>(cp);
+        word_start = is_white_space(cp);
+        return out;
+    } else {
+        return map<Op>(cp);
+    }
+}
+
+/**
+ * @brief Map [src, src + n) into at most `room` units at `dst`; returns
+ *        the units written
+ *
+ * Stops before the first code point that does not fit, so the output is
+ * always a prefix of the full result. Nothing else is tracked in the
+ * loop: `measure` gives the full length when a caller needs it.
+ */
+template <op Op, meta::character CharT>
+constexpr std::size_t convert(const CharT* src, std::size_t n, CharT* dst, std::size_t room) noexcept {
+    std::size_t i = 0, w = 0;
+    bool word_start = true;
+
+    if constexpr (Op != op::title) {
+        if (!std::is_constant_evaluated()) {
+            // All-ASCII strings (most names and identifiers) in one kernel
+            // call, its tail staged through a vector
+            if (n <= room && simd::find_non_ascii(src, n) == n) {
+                simd::ascii_case_convert<ascii_op<Op>>(src, n, dst);
+                return n;
+            }
+        }
+    }
+
+    constexpr std::size_t block = 16 / sizeof(CharT);
+    while (i < n) {
+        std::size_t stop = n;
+        if constexpr (Op != op::title) {
+            // Leading ASCII a vector at a time, then decode: one code point
+            // if that found ASCII, else the rest of the block. Below two
+            // vectors the attempt costs more than it saves
+            if (!std::is_constant_evaluated() && n - i >= 2 * block) {
+                const std::size_t left = n - i < room - w ? n - i : room - w;
+                const std::size_t k = simd::ascii_case_prefix<ascii_op<Op>>(src + i, left, dst + w);
+                i += k;
+                w += k;
+                if (i == n) break;
+                stop = k != 0 ? i + 1 : n - i < block ? n : i + block;
+            }
+        }
+
+        do {
+            const decoded d = decode(src + i, n - i);
+            const char32_t out = map_one<Op>(d.cp, word_start);
+            const unsigned len = encoded_length<CharT>(out);
+            if (len > room - w) return w;
+            encode(out, dst + w);
+            w += len;
+            i += d.len;
+        } while (i < stop);
+    }
+    return w;
+}
+
+// Units the whole mapped [src, src + n) takes
+template <op Op, meta::character CharT>
+constexpr std::size_t measure(const CharT* src, std::size_t n) noexcept {
+    if constexpr (sizeof(CharT) == 4) {
+        return n;
+    } else {
+        using U = std::make_unsigned_t<CharT>;
+        std::size_t i = 0, needed = 0;
+        bool word_start = true;
+
+        while (i < n) {
+            if constexpr (Op != op::title) {
+                if (!std::is_constant_evaluated() && static_cast<U>(src[i]) < 0x80u) {
+                    const std::size_t run = simd::find_non_ascii(src + i, n - i);
+                    i += run;
+                    needed += run;
+                    continue;
+                }
+            }
+
+            const decoded d = decode(src + i, n - i);
+            needed += encoded_length<CharT>(map_one<Op>(d.cp, word_start));
+            i += d.len;
+        }
+        return needed;
+    }
+}
+
+/**
+ * @brief Equality of [a, a + na) and [b, b + nb) after simple case folding
+ *
+ * Equal code points may differ in encoded length (K and U+212A KELVIN
+ * SIGN fold alike), so the comparison walks both sides by code point.
+ */
+template <meta::character CharT>
+constexpr bool equal_folded(const CharT* a, std::size_t na, const CharT* b, std::size_t nb) noexcept {
+    std::size_t ia = 0, ib = 0;
+
+    if (!std::is_constant_evaluated()) {
+        // The vector ASCII compare covers the common prefix; the code
+        // point holding the first difference is decoded from its start
+        const std::size_t common = na < nb ? na : nb;
+        std::size_t i = simd::mismatch_ignore_case(a, b, common);
+        if (i == na && i == nb) return true;
+        while (i > 0 && ((i < na && is_trail(a[i])) || (i < nb && is_trail(b[i])))) --i;
+        ia = ib = i;
+    }
+
+    while (ia < na && ib < nb) {
+        const decoded da = decode(a + ia, na - ia);
+        const decoded db = decode(b + ib, nb - ib);
+        if (da.cp != db.cp && map<op::fold>(da.cp) != map<op::fold>(db.cp)) return false;
+        ia += da.len;
+        ib += db.len;
+    }
+    return ia == na && ib == nb;
+}
+
+} // namespace zuu::detail::unicode_case
+
+namespace zuu::str::unicode {
+
+inline constexpr const char* unicode_version = detail::unicode_case::unicode_version;
+
+// ==================== Code Points ====================
+
+[[nodiscard]] constexpr char32_t simple_lower(char32_t cp) noexcept {
+    return detail::unicode_case::map<detail::unicode_case::op::lower>(cp);
+}
+
+[[nodiscard]] constexpr char32_t simple_upper(char32_t cp) noexcept {
+    return detail::unicode_case::map<detail::unicode_case::op::upper>(cp);
+}
+
+[[nodiscard]] constexpr char32_t simple_title(char32_t cp) noexcept {
+    return detail::unicode_case::map<detail::unicode_case::op::title>(cp);
+}
+
+[[nodiscard]] constexpr char32_t simple_fold(char32_t cp) noexcept {
+    return detail::unicode_case::map<detail::unicode_case::op::fold>(cp);
+}
+
+// ==================== Case Mapping ====================
+
+template <detail::unicode_case::op Op>
+struct case_map_fn : pipe_adaptor<case_map_fn<Op>> {
+    template <meta::character CharT, std::size_t Cap>
+    [[nodiscard]] constexpr basic_fstring<CharT, Cap> apply(const basic_fstring<CharT, Cap>& str) const noexcept {
+        basic_fstring<CharT, Cap> result;
+        result.resize_and_overwrite(Cap, [&](CharT* p, std::size_t room) {
+            return detail::unicode_case::convert<Op>(str.data(), str.size(), p, room);
+        });
+        return result;
+    }
+
+    /**
+     * @brief Append the mapped `str` to `out` (a basic_fstring,
+     *        std::basic_string or span, as concat_into); returns the
+     *        length the whole result needed
+     *
+     * A span's units past the written prefix are scratch: the vector
+     * path may store converted copies there.
+     */
+    template <typename Out, typename Str>
+    constexpr std::size_t into(Out&& out, const Str& str) const {
+        using CharT = piece_char_t<Str>;
+        const std::basic_string_view<CharT> src = piece_view<CharT>(str);
+        const std::size_t total = detail::unicode_case::measure<Op>(src.data(), src.size());
+        return write_into<CharT>(out, total, [&](CharT* dst, std::size_t room) {
+            return detail::unicode_case::convert<Op>(src.data(), src.size(), dst, room);
+        });
+    }
+};
+
+inline constexpr case_map_fn<detail::unicode_case::op::lower> to_lower;
+inline constexpr case_map_fn<detail::unicode_case::op::upper> to_upper;
+// Title mapping after White_Space (and at the start), lowercase elsewhere
+inline constexpr case_map_fn<detail::unicode_case::op::title> to_title;
+inline constexpr case_map_fn<detail::unicode_case::op::fold> fold_case;
+
+// ==================== Caseless Comparison ====================
+
+struct equals_ignore_case_fn {
+    template <meta::character CharT, std::size_t Cap1, std::size_t Cap2>
+    [[nodiscard]] constexpr bool operator()(
+        const basic_fstring<CharT, Cap1>& lhs,
+        const basic_fstring<CharT, Cap2>& rhs
+    ) const noexcept {
+        return detail::unicode_case::equal_folded(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+    }
+
+    template <meta::character CharT, std::size_t Cap>
+    [[nodiscard]] constexpr bool operator()(
+        const basic_fstring<CharT, Cap>& lhs,
+        std::type_identity_t<std::basic_string_view<CharT>> rhs
+    ) const noexcept {
+        return detail::unicode_case::equal_folded(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+    }
+};
+
+inline constexpr equals_ignore_case_fn equals_ignore_case;
+
+} // namespace zuu::str::unicode
@@ -8,6 +8,12 @@
 #include <zuu/fstring.hpp>
 #include <iostream>
 #include <cassert>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <unordered_map>
+#include <vector>
 
 using namespace zuu;
 using namespace zuu::str;
@@ -65,6 +71,143 @@ TEST(element_access) {
     assert(s.at(1) == 'e');
 }
 
+TEST(comparison) {
+    // Stale bytes past size() must not affect equality or ordering
+    fstring<16> a = "abcdef";
+    a.pop_back();
+    a.pop_back();
+    fstring<64> b = "abcd";
+    assert(a == b);
+    assert((a <=> b) == 0);
+    
+    assert("abc"_sfs < "abd"_fs);
+    assert("ab"_sfs < "abc"_sfs);
+    assert(b > std::string_view{"abc"});
+    assert(std::string_view{"abcd"} == b);
+    
+    // An empty string_view has a null data(); no bytes are compared
+    const fstring<8> empty;
+    assert(empty == std::string_view{} && !(a == std::string_view{}));
+    assert(std::string_view{} < a && !(a < std::string_view{}));
+    assert((empty <=> std::string_view{}) == 0);
+    
+    static_assert(fstring<4>{"ab"} < fstring<8>{"abc"});
+    static_assert(fstring<4>{"ab"} == std::string_view{"ab"});
+}
+
+TEST(compact_layout) {
+    static_assert(sizeof(fstring<15>) == 16);
+    static_assert(sizeof(fstring<7>) == 8);
+    static_assert(sizeof(fstring<1000>) < 1008);
+    
+    // Full string: the length slot doubles as the terminator
+    fstring<7> s = "abcdefg";
+    assert(s.full() && s.size() == 7);
+    assert(s.c_str()[7] == '\0');
+    
+    s.pop_back();
+    assert(s.size() == 6 && s == "abcdef");
+    s.clear();
+    assert(s.empty());
+}
+
+TEST(hashing) {
+    // Same value at compile time and at runtime, for any capacity
+    constexpr auto ct = hash_string("orders/2024");
+    fstring<32> key = "orders/2024";
+    assert(hash_string(key) == ct);
+    assert(std::hash<fstring<32>>{}(key) == std::hash<fstring<64>>{}(fstring<64>{"orders/2024"}));
+    
+    std::unordered_map<fstring<16>, int, fstring_hash, fstring_equal> map;
+    map["alpha"] = 1;
+    map["beta"] = 2;
+    assert(map.find(std::string_view{"beta"})->second == 2);
+    assert(map.find("alpha"_fs)->second == 1);
+    assert(map.find(std::string_view{"gamma"}) == map.end());
+}
+
+// N units whose bytes vary in every position, high bytes included for
+// wide types
+template <typename CharT, std::size_t N>
+constexpr basic_fstring<CharT, N> hash_key() {
+    basic_fstring<CharT, N> s;
+    for (std::size_t i = 0; i < N; ++i) {
+        const auto high = sizeof(CharT) > 1 ? (i % 7 + 1) << 8 : 0;
+        s.push_back(CharT(('!' + i * 13 % 94) | high));
+    }
+    return s;
+}
+
+// The constexpr reader and the runtime (vector stripe) path agree past
+// bulk_threshold, through hash_string and std::hash of any capacity
+template <typename CharT, std::size_t N>
+void check_long_hash() {
+    static constexpr auto key = hash_key<CharT, N>();
+    static constexpr std::uint64_t expected = hash_string(key);
+    
+    using exact = basic_fstring<CharT, N>;
+    using wider = basic_fstring<CharT, N + 40>;
+    
+    auto runtime = key;
+    assert(hash_string(runtime) == expected);
+    assert(hash_string(std::basic_string_view<CharT>{runtime}) == expected);
+    assert(std::hash<exact>{}(runtime) == static_cast<std::size_t>(expected));
+    assert(std::hash<wider>{}(wider{runtime}) == static_cast<std::size_t>(expected));
+}
+
+TEST(hashing_long_keys) {
+    check_long_hash<char, 256>();       // last wyhash length
+    check_long_hash<char, 257>();       // first stripe length
+    check_long_hash<char, 300>();
+    check_long_hash<char, 1000>();
+    check_long_hash<char16_t, 129>();
+    check_long_hash<char16_t, 300>();
+    check_long_hash<char16_t, 1000>();
+    check_long_hash<char32_t, 300>();
+    check_long_hash<char32_t, 1000>();
+    static_assert(hash_string(hash_key<char, 1000>()) != hash_string(hash_key<char, 999>()));
+}
+
+TEST(fstring_map) {
+    fstring_map<16, int> ids;
+    for (int i = 0; i < 1000; ++i) {
+        ids[to_fstring(i)] = i;
+    }
+    assert(ids.size() == 1000);
+    assert(ids.at("742") == 742);
+    
+    // Heterogeneous lookup, no key conversion
+    assert(ids.find(std::string_view{"17"})->second == 17);
+    assert(ids.contains("999"_sfs));
+    assert(!ids.contains("1000"));
+    
+    assert(ids.erase("17") == 1);
+    assert(!ids.contains("17") && ids.size() == 999);
+    
+    auto [it, inserted] = ids.try_emplace("17", 71);
+    assert(inserted && it->second == 71);
+}
+
+TEST(intern_pool) {
+    intern_pool<char, 16> pool;
+    const intern_id a = pool.intern("alpha");
+    const intern_id b = pool.intern(std::string_view{"beta"});
+    assert(a != b && a.valid());
+    assert(pool.intern("alpha"_sfs) == a);
+    assert(pool.view(b) == "beta" && pool.resolve(a) == "alpha");
+    
+    // Enough entries to span several arena chunks
+    for (int i = 0; i < 5000; ++i) pool.intern(to_fstring(i % 2500));
+    assert(pool.size() == 2502);
+    assert(pool.view(*pool.find("2499")) == "2499");
+    assert(!pool.find("2500") && pool.size() == 2502);
+    
+    const auto st = pool.stats();
+    assert(st.lookups == 5003 && st.hits == 2501 && st.unique == 2502);
+    assert(st.hit_rate() > 0.49 && st.bytes_saved > 0);
+    assert(std::hash<intern_id>{}(a) != std::hash<intern_id>{}(b));
+}
+
 // ==================== Trim Tests ====================
 
 TEST(trim_operations) {
@@ -83,6 +226,35 @@ TEST(trim_piping) {
     assert(result == "test");
 }
 
+TEST(trim_views) {
+    // Views into the source: same storage, no 256-unit cap
+    const std::string line = "\t\r\n " + std::string(300, 'x') + " \v\f";
+    const std::string_view kept = line | trim_view;
+    assert(kept.data() == line.data() + 4 && kept.size() == 300);
+    assert((line | trim_left_view).size() == 303);
+    assert((trim_right_view(line)).data() == line.data() && trim_right_view(line).size() == 304);
+    assert((std::string_view{"   "} | trim_view).empty());
+    assert(trim_view(std::string_view{}).empty());
+
+    // Every lane width; runs longer than a vector, non-ASCII units kept
+    const fstring<80> padded = fstring<80>(std::string_view{std::string(40, ' ')}) + "\x85" "a b\xA0\n\n\n";
+    assert((padded | trim_view) == "\x85" "a b\xA0");
+    const std::u16string wide = u"  \u3000\u2028 x \t\t\t\t\t\t\t\t\t\t";
+    assert((wide | trim_view) == u"\u3000\u2028 x");
+    assert(((std::u32string(33, U'\t') + U"\U0001F600") | trim) == U"\U0001F600"_fs);
+    static_assert([] {
+        const auto s = "  ok  "_sfs;
+        return (s | trim_view) == "ok";
+    }());
+
+    // trim_if: a shared precomputed charset, or any predicate
+    static constexpr charset<char> dashes{"-_ "};
+    const std::string slug = "--__ core-slug __--";
+    assert((slug | trim_if_view(std::cref(dashes))) == "core-slug");
+    assert((slug | trim_if(std::cref(dashes))) == "core-slug");
+    assert((slug | trim_if_view([](char c) { return c == '-'; })) == "__ core-slug __");
+}
+
 // ==================== Case Tests ====================
 
 TEST(case_conversion) {
@@ -107,6 +279,169 @@ TEST(case_insensitive_compare) {
     assert(equals_ignore_case(s1, s2));
 }
 
+TEST(inplace_algorithms) {
+    const fstring<64> inputs[] = {"", "   ", "  MiXed Case\tText_1  ", "x", "\tALL CAPS\n", "already lower"};
+
+    auto same_as_copy = [](const fstring<64>& s, const auto& op, const auto& inplace) {
+        const auto expected = s | op;
+
+        fstring<64> a = s;
+        inplace(a);
+        fstring<64> b = s;
+        b |= op;
+        fstring<64> c = s;
+        auto d = std::move(c) | op;
+        return a == expected && b == expected && d == expected;
+    };
+
+    for (const auto& s : inputs) {
+        assert(same_as_copy(s, to_lower, to_lower_inplace));
+        assert(same_as_copy(s, to_upper, to_upper_inplace));
+        assert(same_as_copy(s, to_title, to_title_inplace));
+        assert(same_as_copy(s, toggle_case, toggle_case_inplace));
+        assert(same_as_copy(s, trim, trim_inplace));
+        assert(same_as_copy(s, trim_left, trim_left_inplace));
+        assert(same_as_copy(s, trim_right, trim_right_inplace));
+
+        const auto edges = trim_if(charset<char>{" _1"});
+        fstring<64> e = s;
+        assert(apply_inplace(e, edges) == (s | edges));
+
+        fstring<64> f = s;
+        f |= trim | to_lower | to_title;
+        assert(f == (s | trim | to_lower | to_title));
+    }
+
+    // Rvalue chains hand the same storage from stage to stage
+    fstring<4096> big = "  Padded Record  ";
+    auto out = std::move(big) | trim | to_upper;
+    assert(out == "PADDED RECORD");
+}
+
+TEST(vector_case_kernels) {
+    // Every length through the 64/16-byte blocks and the staged tail, with
+    // the bytes around each letter range and non-ASCII units
+    constexpr std::string_view alphabet = "@AZ[`az{ Mixed-Case_09\x80\xC1\xE1\xFF";
+    auto check = [&]<typename CharT>(CharT) {
+        for (std::size_t len = 0; len <= 100; ++len) {
+            basic_fstring<CharT, 128> s;
+            for (std::size_t i = 0; i < len; ++i) {
+                s.push_back(static_cast<CharT>(static_cast<unsigned char>(alphabet[(i * 7) % alphabet.size()])));
+            }
+            if constexpr (sizeof(CharT) > 1) {
+                if (len > 0) s[len / 2] = static_cast<CharT>(0x100 + 'A');
+            }
+
+            const auto lower = s | to_lower;
+            const auto upper = s | to_upper;
+            const auto toggled = s | toggle_case;
+            for (std::size_t i = 0; i < len; ++i) {
+                assert(lower[i] == char_to_lower(s[i]));
+                assert(upper[i] == char_to_upper(s[i]));
+                assert(toggled[i] == static_cast<CharT>(is_alpha(s[i]) ? s[i] ^ 0x20 : s[i]));
+            }
+            assert(lower.size() == len && upper.size() == len && toggled.size() == len);
+
+            assert(equals_ignore_case(s, upper) && equals_ignore_case(lower, toggled));
+            if (len > 0) {
+                auto other = lower;
+                other[len - 1] = static_cast<CharT>('#');
+                assert(!equals_ignore_case(s, other) || s[len - 1] == CharT('#'));
+            }
+        }
+    };
+    check(char{});
+    check(char16_t{});
+    check(char32_t{});
+
+    // Trim moves the window, then the kernel writes back over the same buffer
+    fstring<128> padded = "      HTTP-Header-Name-Padded-Far-Enough-To-Use-Two-Vector-Blocks-And-Then-Some   ";
+    padded |= trim | to_lower;
+    assert(padded == "http-header-name-padded-far-enough-to-use-two-vector-blocks-and-then-some");
+
+    // Constant evaluation keeps the scalar loops
+    static_assert(("Content-Type"_sfs | to_lower) == "content-type");
+    static_assert(equals_ignore_case("X-Request-Id"_sfs, "x-request-id"_sfs));
+}
+
+TEST(case_insensitive_suite) {
+    const fstring<96> header = "Accept: text/html\r\nContent-TYPE: Application/JSON; charset=UTF-8";
+
+    // Search: one-unit, filtered (<= 32 units) and Two-Way needles
+    assert(find_ignore_case(header, 'T') == header.find('t'));
+    assert(find_ignore_case(header, "content-type") == 19);
+    assert(find_ignore_case(header, "CHARSET", 20) == 51);
+    assert(find_ignore_case(header, "content-type: application/json; CHARSET") == 19);
+    assert(find_ignore_case(header, "text/xml") == fstring<96>::npos);
+    assert(contains_ignore_case(header, "utf-8") && !contains_ignore_case(header, "utf-16"));
+    assert(header | contains_ignore_case("ACCEPT"));
+    assert(starts_with_ignore_case(header, "ACCEPT:") && !starts_with_ignore_case("Acc"_fs, "accept"));
+    assert(ends_with_ignore_case(header, "charset=utf-8") && (header | ends_with_ignore_case("UTF-8")));
+
+    // Weak ordering on the lowercased units
+    assert(compare_ignore_case("Alpha"_fs, "ALPHA"_fs) == 0);
+    assert(compare_ignore_case("alpha"_fs, "BETA"_fs) < 0);
+    assert(compare_ignore_case("Zeta"_fs, std::string_view{"alphabet"}) > 0);
+    assert(compare_ignore_case("abc"_fs, "ABCD"_fs) < 0);
+    assert(equals_ignore_case("Select"_fs, std::string_view{"SELECT"}));
+
+    // Hash consistent with equality, at compile time and runtime
+    static_assert(hash_string_icase("Content-Type") == hash_string("content-type"));
+    assert(hash_string_icase(header) == hash_string(header | to_lower));
+    assert(hash_string_icase(u"X-Request-Id") == hash_string(u"x-request-id"));
+
+    std::unordered_map<fstring<32>, int, fstring_icase_hash, fstring_icase_equal> headers;
+    headers["Content-Length"] = 42;
+    headers["content-length"] += 1;
+    assert(headers.size() == 1);
+    assert(headers.find(std::string_view{"CONTENT-LENGTH"})->second == 43);
+
+    std::map<fstring<16>, int, icase_less> columns{{"Id", 0}, {"name", 1}, {"NAME", 2}};
+    assert(columns.size() == 2 && columns.begin()->first == "Id");
+    assert(columns.find(std::string_view{"ID"}) != columns.end());
+
+    static_assert(find_ignore_case("Hello World"_sfs, "WORLD") == 6);
+    static_assert(compare_ignore_case("abc"_sfs, "ABD"_sfs) < 0);
+}
+
+TEST(unicode_case_mapping) {
+    // Simple mappings and folding, code point by code point
+    static_assert(unicode::simple_lower(U'\u00C9') == U'\u00E9' && unicode::simple_upper(U'\u03C9') == U'\u03A9');
+    static_assert(unicode::simple_title(U'\u01C6') == U'\u01C5' && unicode::simple_upper(U'\u01C6') == U'\u01C4');
+    static_assert(unicode::simple_fold(U'\u212A') == U'k' && unicode::simple_fold(U'\u03C2') == U'\u03C3');
+    static_assert(unicode::simple_upper(U'\U00010428') == U'\U00010400');
+
+    // UTF-8, UTF-16 and UTF-32 strings; ASCII runs take the vector path
+    const u8fstring<64> name = u8"\u00C9MILE Zola \u2160\u2161 \u0394\u0399\u039F";
+    assert((name | unicode::to_lower) == u8"\u00E9mile zola \u2170\u2171 \u03B4\u03B9\u03BF");
+    assert((u8"o'connor \u00E9mile"_fs | unicode::to_title) == u8"O'connor \u00C9mile");
+    assert((u"stra\u00DFe \U00010428"_fs | unicode::to_upper) == u"STRA\u00DFE \U00010400");
+    assert((U"\u01C4ERO"_fs | unicode::fold_case) == U"\u01C6ero");
+
+    // Malformed units pass through unchanged
+    const char8_t junk[] = {u8'A', char8_t(0xC3), u8'B', char8_t(0xFF), 0};
+    const char8_t junk_lower[] = {u8'a', char8_t(0xC3), u8'b', char8_t(0xFF), 0};
+    assert((u8fstring<8>(junk) | unicode::to_lower) == u8fstring<8>(junk_lower));
+    const char16_t lone[] = {u'Q', char16_t(0xD801), u'Q', 0};
+    assert((u16fstring<4>(lone) | unicode::to_lower)[1] == char16_t(0xD801));
+
+    // Growth against the fixed capacity: cut between code points only
+    const u8fstring<8> grows = u8"\u023A\u023A\u023A\u023A";  // 2 bytes each, 3 lowercased
+    const auto cut = grows | unicode::to_lower;
+    assert(cut == u8"\u2C65\u2C65" && cut.size() == 6);
+    u8fstring<8> out;
+    assert(unicode::to_lower.into(out, grows) == 12 && out == cut);
+    std::u8string whole;
+    unicode::to_lower.into(whole, grows);
+    assert(whole.size() == 12);
+
+    // Caseless comparison, including different encoded lengths
+    assert(unicode::equals_ignore_case(name, u8"\u00E9MILE ZOLA \u2170\u2171 \u03B4\u03B9\u03BF"));
+    assert(unicode::equals_ignore_case(u8"Kelvin"_fs, u8"\u212Aelvin"));
+    assert(!unicode::equals_ignore_case(u8"stra\u00DFe"_fs, u8"STRASSE"));  // full folding is out of scope
+    static_assert(unicode::equals_ignore_case(u"\u03A3\u03C3"_fs, u"\u03C3\u03C2"));
+}
+
 // ==================== Split Tests ====================
 
 TEST(split_char) {
@@ -142,6 +477,66 @@ TEST(split_whitespace) {
     assert(parts[3] == "d");
 }
 
+// 200 units, so the runtime scan crosses three 64-unit blocks and ends in
+// a partial one: delimiters every 7 units and at 63 and 64, a run over
+// [120, 136), a "\r\n" straddling 63|64 and a lone '\r' at 111
+enum class block_split { by_char, lines, whitespace };
+
+template <typename CharT>
+constexpr basic_fstring<CharT, 200> block_text(block_split kind) {
+    basic_fstring<CharT, 200> s;
+    for (std::size_t i = 0; i < 200; ++i) {
+        CharT c = CharT('a' + i % 26);
+        if (i % 7 == 6 || i == 63 || i == 64 || (i >= 120 && i < 136)) {
+            switch (kind) {
+                case block_split::by_char:    c = CharT(','); break;
+                case block_split::lines:      c = CharT(i == 63 || i == 111 ? '\r' : '\n'); break;
+                case block_split::whitespace: c = CharT(" \t\n\r\f\v"[i % 6]); break;
+            }
+        }
+        s.push_back(c);
+    }
+    return s;
+}
+
+template <std::size_t MaxParts, typename CharT, std::size_t Cap>
+constexpr auto split_blocks(const basic_fstring<CharT, Cap>& s, block_split kind) {
+    switch (kind) {
+        case block_split::by_char: return split.operator()<CharT, Cap, MaxParts>(s, CharT(','));
+        case block_split::lines:   return split_lines.apply<CharT, Cap, MaxParts>(s);
+        default:                   return split_whitespace.apply<CharT, Cap, MaxParts>(s);
+    }
+}
+
+// Runtime (bitmask) split against the constexpr loop, all tokens and capped
+template <typename CharT, block_split Kind>
+void check_split_blocks() {
+    static constexpr auto text = block_text<CharT>(Kind);
+    static constexpr auto all = split_blocks<64>(text, Kind);
+    static constexpr auto capped = split_blocks<16>(text, Kind);
+    static_assert(all.count > 16 && capped.count == 16);
+    
+    auto input = text;
+    const auto got_all = split_blocks<64>(input, Kind);
+    const auto got_capped = split_blocks<16>(input, Kind);
+    assert(got_all.count == all.count && got_capped.count == capped.count);
+    for (std::size_t i = 0; i < all.count; ++i) assert(got_all[i] == all[i]);
+    for (std::size_t i = 0; i < capped.count; ++i) assert(got_capped[i] == capped[i]);
+}
+
+TEST(split_across_blocks) {
+    check_split_blocks<char, block_split::by_char>();
+    check_split_blocks<char, block_split::lines>();
+    check_split_blocks<char, block_split::whitespace>();
+    check_split_blocks<char16_t, block_split::by_char>();
+    check_split_blocks<char16_t, block_split::lines>();
+    check_split_blocks<char16_t, block_split::whitespace>();
+    
+    // Lines on either side of the "\r\n" at 63|64 keep no '\r'
+    static constexpr auto lines = split_blocks<64>(block_text<char>(block_split::lines), block_split::lines);
+    static_assert(lines[8] == "efghij" && lines[9] == "nopq");
+}
+
 TEST(split_piping) {
     auto parts = "  a , b , c  "_fs | trim | split(',');
     assert(parts.count == 3);
@@ -161,6 +556,35 @@ TEST(rsplit) {
     assert(parts[3] == "d");
 }
 
+TEST(split_lazy) {
+    static_assert(std::ranges::forward_range<decltype("a"_fs | split_lazy(','))>);
+    
+    // No MaxParts limit: 40 fields, each a view into the source
+    fstring<128> row;
+    for (int i = 0; i < 40; ++i) {
+        if (i) row.push_back(',');
+        row.push_back('x');
+    }
+    std::size_t fields = 0;
+    for (std::string_view f : row | split_lazy(',')) {
+        assert(f == "x" && f.data() >= row.data() && f.data() < row.data() + row.size());
+        ++fields;
+    }
+    assert(fields == 40);
+    
+    // Empty tokens are skipped, as in split()
+    auto it = ",,a,,bc,"_fs | split_lazy(',');
+    assert(std::ranges::distance(it) == 2 && *std::ranges::next(it.begin()) == "bc");
+    
+    std::string_view expect[] = {"a", "b", "c"};
+    assert(std::ranges::equal("a::b::::c"_fs | split_by_lazy("::"), expect));
+    assert(std::ranges::equal("a\r\nb\n\nc\r"_fs | split_lines_lazy, expect));
+    assert(std::ranges::equal(" a \t b\nc "_fs | split_whitespace_lazy, expect));
+    assert(std::ranges::equal("a; b,c"_fs | split_lazy(charset{" ,;"}), expect));
+    assert(std::ranges::equal("c.b..a."_fs | rsplit_lazy('.'), expect));
+    assert(split_lazy(std::string_view{",,,"}, ',').empty());
+}
+
 // ==================== Join Tests ====================
 
 TEST(join_char) {
@@ -182,6 +606,45 @@ TEST(join_split_roundtrip) {
     assert(original == rejoined);
 }
 
+TEST(concat) {
+    fstring<8> dir = "/tmp";
+    std::string name = "log";
+    auto path = concat(dir, '/', "app"_sfs, ".txt"_sfs);
+    static_assert(decltype(path)::capacity == 8 + 1 + 32 + 32);
+    assert(path == "/tmp/app.txt");
+
+    fstring<16> line = "k";
+    auto n = concat_into(line, " = ", std::string_view{"value"}, name);
+    assert(n == 11 && line == "k = valuelog");
+    n = concat_into(line, "0123456789");     // snprintf-style: needed, not written
+    assert(n == 10 && line.size() == 16 && line == "k = valuelog0123");
+
+    std::vector<std::string> words = {"alpha", "beta", "gamma"};
+    std::string out;
+    assert(join_into(out, words, ", ") == 18 && out == "alpha, beta, gamma");
+
+    char buf[8];
+    n = join_into(std::span{buf}, "a,b,c"_sfs | split_lazy(','), "--");
+    assert(n == 7 && std::string_view(buf, 7) == "a--b--c");
+    
+    // Single-pass source: pieces land one after another in the span
+    auto lines = io::line_reader::from_memory("alpha\nbeta\ngamma\n");
+    char flat[24];
+    n = join_into(std::span{flat}, lines, ", ");
+    assert(n == 18 && std::string_view(flat, 18) == "alpha, beta, gamma");
+
+    auto parts = split("x,y,z"_sfs, ',');
+    const char* long_delim = " <--------------------------------------------------------------------> ";
+    auto joined = join(parts, long_delim);
+    assert(joined.size() == 3 + 2 * std::char_traits<char>::length(long_delim));
+    assert(join(parts, " | ") == "x | y | z");
+    
+    // Array delimiter filled at runtime: its text, not the whole array
+    char sep[8] = {};
+    std::char_traits<char>::copy(sep, "; ", 2);
+    assert(join(parts, sep) == "x; y; z");
+}
+
 // ==================== Find Tests ====================
 
 TEST(contains_operations) {
@@ -220,6 +683,87 @@ TEST(find_operations) {
     assert(pos3 == 6);
 }
 
+TEST(find_long_strings) {
+    // Long enough to exercise the vectorized runtime path
+    fstring<128> s(100, 'a');
+    s[70] = 'x';
+    s[90] = 'x';
+    
+    assert(s.find('x') == 70);
+    assert(s.find('x', 71) == 90);
+    assert(s.find('y') == fstring<128>::npos);
+    assert(s.rfind('x') == 90);
+    assert(s.rfind('x', 89) == 70);
+    assert(s.rfind('x', 69) == fstring<128>::npos);
+    
+    u16fstring<64> w(40, u'a');
+    w[35] = u'b';
+    assert(w.find(u'b') == 35);
+    assert(w.rfind(u'a') == 39);
+    
+    u32fstring<64> d(40, U'a');
+    d[3] = U'b';
+    assert(d.find(U'b') == 3);
+    assert(d.rfind(U'b') == 3);
+}
+
+TEST(find_substring_engine) {
+    fstring<128> s = "abababcabababcx, periodic needles and some more filler text";
+    
+    // Short needle (vector filter) and long needle (Two-Way)
+    assert(s.find("abababcx") == 7);
+    assert(s.find(std::string_view{"periodic needles and some more filler"}) == 17);
+    assert(s.find("abababcy") == fstring<128>::npos);
+    assert(s.find("abc", 5) == 11);
+    
+    std::string_view needle = "ab";
+    assert(find(s, needle) == 0);
+    assert(count(s, "ab") == 6);
+    assert(count(s, "aba") == 2);
+}
+
+TEST(precompiled_searcher) {
+    static constexpr searcher error_tag{"ERROR"};
+    static_assert(error_tag.size() == 5);
+    static_assert(error_tag.find("log: ERROR"_sfs) == 5);
+    
+    fstring<64> line = "2025-11-26 [ERROR] disk full, ERROR again";
+    assert(line | contains(error_tag));
+    assert(find(line, error_tag) == 12);
+    assert(count(line, error_tag) == 2);
+    assert(!("all good"_sfs | contains(error_tag)));
+    
+    // Runtime construction from an fstring
+    fstring<16> word = "disk";
+    searcher<char, 16> dyn{word};
+    assert(dyn.find(line) == 19);
+}
+
+static constexpr std::string_view ac_keywords[] = {"he", "she", "his", "hers"};
+
+TEST(multi_matcher) {
+    static constexpr auto kw = make_multi_matcher<ac_keywords>();
+    static_assert(kw.contains("ushers"));
+    static_assert(kw.count("ushers") == 3);   // she, he, hers
+    
+    fstring<32> line = "ushers";
+    auto first = line | match_first(kw);
+    assert(first.found());
+    assert(first.pattern == 1 && first.position == 1 && first.length == 3);
+    
+    auto mask = line | match_mask(kw);
+    assert(mask.test(0) && mask.test(1) && !mask.test(2) && mask.test(3));
+    
+    // Runtime keyword set + batch scan
+    std::string words[] = {"error", "fatal"};
+    multi_matcher<char> runtime{words};
+    fstring<32> records[] = {"ok", "fatal: x", "an error", "fine", "nope"};
+    bool hits[5]{};
+    runtime.contains_batch(records, hits);
+    assert(!hits[0] && hits[1] && hits[2] && !hits[3] && !hits[4]);
+    assert(records[2] | contains(runtime));
+}
+
 TEST(count_operations) {
     fstring<32> s = "hello world";
     
@@ -248,6 +792,26 @@ TEST(contains_any) {
     assert(!contains_any(s, "xyz"));
 }
 
+TEST(charset_scans) {
+    static constexpr charset<char> delims{" ,;:\t"};
+    static_assert(delims.contains(';') && !delims.contains('a'));
+    
+    // Long enough to exercise the vector classifier
+    fstring<128> line = "alpha beta,gamma;delta:epsilon\tzeta eta,theta;iota kappa";
+    assert((line | find_first_of(delims)) == 5);
+    assert((line | find_last_of(delims)) == 50);
+    assert(find_first_not_of(line, "ablph") == 5);
+    assert((line | find_last_not_of(" kap")) == 48);
+    assert(line | contains_any(delims));
+    
+    auto parts = line | split(delims);
+    assert(parts.size() == 10);
+    assert(parts[0] == "alpha" && parts[9] == "kappa");
+    
+    auto trimmed = "--[x_y]__"_fs | trim_if(charset{"-_[]"});
+    assert(trimmed == "x_y");
+}
+
 // ==================== Formatting Tests ====================
 
 TEST(integer_formatting) {
@@ -256,6 +820,25 @@ TEST(integer_formatting) {
     assert(to_fstring(0) == "0");
 }
 
+TEST(integer_formatting_exact) {
+    // Every length, both signs, the type limits; digits land in place
+    std::uint64_t p = 1;
+    for (int k = 1; k <= 19; ++k, p *= 10) {
+        for (std::uint64_t v : {p - 1, p, p + 7, p * 9 + 99}) {
+            char buf[24];
+            const auto end = std::to_chars(buf, buf + sizeof buf, v).ptr;
+            assert(to_fstring(v) == std::string_view(buf, end));
+        }
+    }
+    assert(to_fstring(std::numeric_limits<std::uint64_t>::max()) == "18446744073709551615");
+    assert(to_fstring(std::numeric_limits<std::int64_t>::min()) == "-9223372036854775808");
+    assert(to_fstring(std::numeric_limits<int>::min()) == "-2147483648");
+    assert(to_fstring(std::int8_t{-128}) == "-128" && to_fstring(std::uint16_t{65535}) == "65535");
+    assert(formatter<long>::format<char16_t>(-40302010) == u"-40302010");
+    static_assert(to_fstring(1234567890123ull) == "1234567890123");
+    static_assert(to_fstring(-7) == "-7");
+}
+
 TEST(hex_formatting) {
     assert(to_fstring(hex(255)) == "0xff");
     assert(to_fstring(hex(255, true)) == "0xFF");
@@ -281,6 +864,45 @@ TEST(float_formatting) {
     assert(f2 == "2.718");
 }
 
+TEST(float_formatting_shortest) {
+    // Shortest digits that read back, the shorter of fixed and scientific
+    assert(to_fstring(0.1) == "0.1" && to_fstring(0.3) == "0.3" && to_fstring(100.0) == "100");
+    assert(to_fstring(1e23) == "1e+23" && to_fstring(1e-4) == "1e-04" && to_fstring(-0.0) == "-0");
+    assert(to_fstring(5e-324) == "5e-324" && to_fstring(1.7976931348623157e308) == "1.7976931348623157e+308");
+    assert(to_fstring(1e300 * 1e10) == "inf" && to_fstring(-1e300 * 1e10) == "-inf");
+    assert(to_fstring(std::numeric_limits<double>::quiet_NaN()) == "nan");
+    assert(to_fstring(0.1f) == "0.1" && to_fstring(16777216.0f) == "16777216");
+    for (double v : {1.0 / 3, 2.0 / 3, 123.456, 6.02214076e23, 1e-7, 9007199254740993.0, 1125899906842624.25}) {
+        char buf[32];
+        const auto end = std::to_chars(buf, buf + sizeof buf, v).ptr;
+        assert(to_fstring(v) == std::string_view(buf, end));
+    }
+
+    // Precision rounds the exact binary value half to even, like printf
+    assert(to_fstring(fixed(0.1, 20)) == "0.10000000000000000555");
+    assert(to_fstring(fixed(2.5, 0)) == "2" && to_fstring(fixed(3.5, 0)) == "4");
+    assert(to_fstring(fixed(1.005, 2)) == "1.00" && to_fstring(fixed(-0.001, 2)) == "-0.00");
+    assert(to_fstring(fixed(1e22)) == "10000000000000000000000");
+    assert(to_fstring(scientific(1500.0, 2)) == "1.50e+03" && to_fstring(scientific(9.9999, 2)) == "1.00e+01");
+    assert(to_fstring(scientific(0.0, 1)) == "0.0e+00" && to_fstring(scientific(1e-300)) == "1e-300");
+    assert(to_fstring(general(0.0001234, 3)) == "0.000123" && to_fstring(general(123456789.0, 4)) == "1.235e+08");
+    assert(to_fstring(general(100.0)) == "100" && to_fstring(general(1e6)) == "1e+06");
+
+    // In place into a line, cut like any append when it runs out
+    fstring<32> line = "t=";
+    format_to(line, 0.25);
+    format_to(line, fixed(-1.5, 3));
+    assert(line == "t=0.25-1.500");
+    fstring<8> tight = "x=";
+    format_to(tight, 1.0 / 3);
+    assert(tight == "x=0.3333");
+    assert(formatter<double>::format<char16_t>(0.5) == u"0.5");
+
+    static_assert(to_fstring(0.1) == "0.1");
+    static_assert(to_fstring(fixed(1e300, 0)).size() == 64);
+    static_assert(to_fstring(scientific(2.0f / 3, 3)) == "6.667e-01");
+}
+
 TEST(bool_formatting) {
     assert(to_fstring(true) == "true");
     assert(to_fstring(false) == "false");
@@ -294,6 +916,43 @@ TEST(parse_int) {
     assert(parse_int<int>("0"_sfs) == 0);
 }
 
+TEST(integer_parsing_checked) {
+    // Value, units read and error, where garbage and a real 0 used to
+    // look the same
+    auto r = parse_int<int>("0"_sfs);
+    assert(r && r.value == 0 && r.count == 1);
+    r = parse_int<int>("abc"_sfs);
+    assert(r.ec == std::errc::invalid_argument && r.count == 0 && r == 0);
+    r = parse_int<int>(std::string_view{"-2147483648,5"});
+    assert(r && r.value == -2147483648 && r.count == 11);
+    r = parse_int<int>(std::string_view{"2147483648"});
+    assert(r.ec == std::errc::result_out_of_range && r.count == 10 && r.value == 0);
+
+    // 8- and 16-digit chunks, with the 20-digit edge of uint64_t
+    assert(parse_int<unsigned long long>("1234567890123456789"_sfs) == 1234567890123456789ull);
+    assert(parse_int<unsigned long long>("18446744073709551615"_sfs) == 18446744073709551615ull);
+    assert(parse_int<unsigned long long>("18446744073709551616"_sfs).ec == std::errc::result_out_of_range);
+    assert(parse_int<unsigned long long>("000000000000000000000000042"_sfs) == 42);
+    assert(parse_int<unsigned>("-1"_sfs).ec == std::errc::invalid_argument);
+    assert(parse_int<std::uint8_t>("256"_sfs).ec == std::errc::result_out_of_range);
+
+    // Power-of-two bases by digit width, others checked per digit
+    assert(parse_int<std::uint32_t>("DeadBeef"_sfs, 16) == 0xDEADBEEFu);
+    assert(parse_int<std::uint64_t>("ffffffffffffffff"_sfs, 16) == ~std::uint64_t{0});
+    assert(parse_int<std::uint64_t>("1ffffffffffffffff"_sfs, 16).ec == std::errc::result_out_of_range);
+    assert(parse_int<int>("-101010"_sfs, 2) == -42);
+    assert(parse_int<std::uint64_t>("1777777777777777777777"_sfs, 8) == ~std::uint64_t{0});
+    assert(parse_int<std::uint64_t>("2000000000000000000000"_sfs, 8).ec == std::errc::result_out_of_range);
+    assert(parse_int<int>("zz"_sfs, 36) == 1295);
+    assert(parse_int<int>("1"_sfs, 37).ec == std::errc::invalid_argument);
+    static_assert(parse_int<long long>(std::string_view{"-9223372036854775808"}) == (-9223372036854775807ll - 1));
+
+    const std::u16string_view wide = u"+77 rest";
+    short v = 0;
+    const auto w = from_chars(wide.data(), wide.data() + wide.size(), v);
+    assert(w && v == 77 && w.ptr == wide.data() + 3);
+}
+
 TEST(parse_float) {
     float f1 = parse_float<float>("3.14"_sfs);
     assert(f1 > 3.13 && f1 < 3.15);
@@ -302,6 +961,53 @@ TEST(parse_float) {
     assert(f2 > 2.70 && f2 < 2.72);
 }
 
+TEST(float_parsing_exact) {
+    // Correctly rounded, where fraction *= 0.1 was off in the last bits
+    assert(parse_float<double>("0.3"_sfs) == 0.3);
+    assert(parse_float<double>("1e5"_sfs) == 1e5);
+    assert(parse_float<double>("-2.5E-3"_sfs) == -2.5e-3);
+    assert(parse_float<double>("9007199254740993"_sfs) == 9007199254740992.0);  // halfway, to even
+    assert(parse_float<double>("2.2250738585072011e-308"_sfs) == 2.2250738585072011e-308);
+    assert(parse_float<double>("4.9406564584124654e-324"_sfs) == 4.9406564584124654e-324);
+    assert(parse_float<double>("123456789012345678901234567890"_sfs) == 1.2345678901234568e29);
+    assert(parse_float<float>("3.4028235e38"_sfs) == 3.4028235e38f);
+    static_assert(parse_float<double>(std::string_view{"0.1"}) == 0.1);
+
+    const std::string_view csv = "1.5,-0.25e2,abc,1e400,nan,.5x";
+    const char* p = csv.data();
+    const char* last = p + csv.size();
+    double v = 0;
+
+    auto r = from_chars(p, last, v);
+    assert(r && v == 1.5 && *r.ptr == ',');
+    r = from_chars(r.ptr + 1, last, v);
+    assert(r && v == -25.0 && *r.ptr == ',');
+    const char* bad = r.ptr + 1;
+    r = from_chars(bad, last, v);
+    assert(r.ec == std::errc::invalid_argument && r.ptr == bad && v == -25.0);
+    r = from_chars(bad + 4, last, v);
+    assert(r.ec == std::errc::result_out_of_range && r.ptr == bad + 9 && v == -25.0);
+    r = from_chars(r.ptr + 1, last, v);
+    assert(r && v != v);
+    r = from_chars(r.ptr + 1, last, v);
+    assert(r && v == 0.5 && *r.ptr == 'x');
+
+    // A leading '+' is accepted (std::from_chars rejects it), but only once
+    const std::string_view plus = "+1.5 +inf +-1";
+    r = from_chars(plus.data(), plus.data() + plus.size(), v);
+    assert(r && v == 1.5 && r.ptr == plus.data() + 4);
+    r = from_chars(r.ptr + 1, plus.data() + plus.size(), v);
+    assert(r && v == std::numeric_limits<double>::infinity());
+    r = from_chars(r.ptr + 1, plus.data() + plus.size(), v);
+    assert(r.ec == std::errc::invalid_argument);
+    assert(parse_int<unsigned>("+7"_sfs) == 7u && parse_int<int>("+-7"_sfs).count == 0);
+
+    const std::u16string_view wide = u"-Infinity";
+    float f = 0;
+    const auto w = from_chars(wide.data(), wide.data() + wide.size(), f);
+    assert(w && f == -std::numeric_limits<float>::infinity() && w.ptr == wide.data() + wide.size());
+}
+
 // ==================== Complex Pipeline Tests ====================
 
 TEST(complex_pipeline_1) {
@@ -347,6 +1053,35 @@ TEST(complex_pipeline_3) {
     assert(fields[2] == "Developer");
 }
 
+TEST(fused_pipeline) {
+    constexpr auto normalize = trim | to_lower | to_title;
+    static_assert(std::is_same_v<decltype(normalize), const fused_pipe<trim_fn, to_lower_fn, to_title_fn>>);
+    static_assert(decltype(normalize)::passes == 1);
+    static_assert(("  hELLO   wORLD  "_sfs | normalize) == "Hello   World");
+
+    fstring<32> raw = "  Some_Mixed-KEY  ";
+    auto key = raw | (trim | to_upper | replace_char('_', ' ') | erase_char('-'));
+    assert(key == "SOME MIXEDKEY");
+    assert(key == (raw | trim | to_upper | replace_char('_', ' ') | erase_char('-')));
+
+    // Narrowing after a filter adjusts the written window, no extra loop
+    constexpr auto digits = filter([](char c) { return (c >= '0' && c <= '9') || c == ' '; }) | trim | substr(0, 3);
+    static_assert(decltype(digits)::passes == 1);
+    assert(("x 12a34 y"_sfs | digits) == "123");
+
+    // Element-wise stages on both sides of a narrowing one: two loops
+    auto odd = to_lower | trim_right | erase_char('x');
+    static_assert(decltype(odd)::passes == 2);
+    assert(("AxBX  "_sfs | odd) == "ab");
+
+    // Views keep the unfused fstring<256>; into() picks the capacity
+    std::string_view sv = "  Padded  ";
+    static_assert(decltype(sv | normalize)::capacity == 256);
+    fstring<4> small;
+    normalize.into(small, sv);
+    assert(small == "Padd");
+}
+
 // ==================== Constexpr Tests ====================
 
 constexpr auto compile_time_test() {
@@ -380,6 +1115,69 @@ TEST(type_aliases) {
     assert(ip.max_size() == 45);
 }
 
+// ==================== I/O Tests ====================
+
+TEST(line_reader) {
+    const std::string text = "alpha\r\n\n  beta  \n" + std::string(100, 'x') + "\nlast";
+    const auto path = std::filesystem::temp_directory_path() / "zuu_line_reader_test.txt";
+    std::ofstream{path, std::ios::binary} << text;
+    
+    // Tiny buffer: lines straddle reads and the buffer grows for the long one
+    for (auto mode : {io::read_mode::buffered, io::read_mode::mapped}) {
+        io::line_reader in{path.c_str(), {.buffer_size = 8, .mode = mode}};
+        std::vector<std::string> lines;
+        for (std::string_view line : in) lines.emplace_back(line);
+        assert(lines.size() == 5 && in.line_number() == 5);
+        assert(lines[0] == "alpha" && lines[1].empty() && lines[3].size() == 100 && lines[4] == "last");
+    }
+    std::filesystem::remove(path);
+    
+    // Composes with pipes; overflow policies for fixed-capacity lines
+    auto mem = io::line_reader::from_memory(text);
+    std::string_view line;
+    mem.next(line);
+    mem.next(line);
+    mem.next(line);
+    assert((line | trim) == "beta");
+    
+    fstring<40> rec;
+    assert(mem.next(rec, io::overflow_policy::split) && rec.size() == 40);
+    assert(mem.next(rec, io::overflow_policy::split) && rec.size() == 40);
+    assert(mem.next(rec, io::overflow_policy::split) && rec.size() == 20);
+    assert(mem.next(rec) && rec == "last" && !mem.next(rec));
+    
+    auto skip = io::line_reader::from_memory(text);
+    std::size_t kept = 0;
+    while (skip.next(rec, io::overflow_policy::skip)) ++kept;
+    assert(kept == 4);
+}
+
+TEST(csv_reader) {
+    // Quoted delimiters, doubled quotes, embedded newline, CRLF, blank line, >16 columns
+    std::string text = "id,name,note\r\n7,\"Smith, J\",\"said \"\"hi\"\"\"\n\n8,\"multi\nline\",\n";
+    for (int i = 0; i < 20; ++i) text += i ? ",c" : "c";
+    
+    auto in = csv::reader::from_memory(text, csv::rfc4180, 64);
+    csv::row row;
+    assert(in.next(row) && row.size() == 3 && row[2] == "note");
+    
+    fstring<4> id;
+    fstring<8> name;
+    std::string_view note;
+    assert(in.next(row) && row.into(id, name, note) == 3);
+    assert(id == "7" && name == "Smith, J" && note == "said \"hi\"");
+    
+    assert(in.next(row) && row[1] == "multi\nline" && row[2].empty());
+    assert(in.next(row) && row.size() == 20 && row[19] == "c");
+    assert(!in.next(row) && in.rows_read() == 4);
+    
+    // Batched rows and TSV
+    auto tsv_in = csv::reader::from_memory("a\tb\n\"x\ty\"\tz\n", csv::tsv);
+    csv::batch rows;
+    assert(tsv_in.next_batch(rows) == 2 && rows[1][0] == "x\ty" && rows[1][1] == "z");
+    assert(tsv_in.next_batch(rows) == 0);
+}
+
 // ==================== Edge Cases ====================
 
 TEST(empty_string_operations) {
@@ -423,51 +1221,78 @@ int main() {
     run_test_basic_construction();
     run_test_concatenation();
     run_test_element_access();
+    run_test_comparison();
+    run_test_compact_layout();
+    run_test_hashing();
+    run_test_hashing_long_keys();
+    run_test_fstring_map();
+    run_test_intern_pool();
     
     run_test_trim_operations();
     run_test_trim_piping();
+    run_test_trim_views();
     
     run_test_case_conversion();
     run_test_case_piping();
     run_test_case_insensitive_compare();
+    run_test_inplace_algorithms();
+    run_test_vector_case_kernels();
+    run_test_case_insensitive_suite();
+    run_test_unicode_case_mapping();
     
     run_test_split_char();
     run_test_split_string();
     run_test_split_lines();
     run_test_split_whitespace();
+    run_test_split_across_blocks();
     run_test_split_piping();
     run_test_partition();
     run_test_rsplit();
+    run_test_split_lazy();
     
     run_test_join_char();
     run_test_join_string();
     run_test_join_split_roundtrip();
+    run_test_concat();
     
     run_test_contains_operations();
     run_test_starts_ends_with();
     run_test_find_operations();
+    run_test_find_long_strings();
+    run_test_find_substring_engine();
+    run_test_precompiled_searcher();
+    run_test_multi_matcher();
     run_test_count_operations();
     run_test_find_first_of();
     run_test_contains_any();
+    run_test_charset_scans();
     
     run_test_integer_formatting();
+    run_test_integer_formatting_exact();
     run_test_hex_formatting();
     run_test_binary_formatting();
     run_test_padding_formatting();
     run_test_float_formatting();
+    run_test_float_formatting_shortest();
     run_test_bool_formatting();
     
     run_test_parse_int();
+    run_test_integer_parsing_checked();
     run_test_parse_float();
+    run_test_float_parsing_exact();
     
     run_test_complex_pipeline_1();
     run_test_complex_pipeline_2();
     run_test_complex_pipeline_3();
+    run_test_fused_pipeline();
     
     run_test_constexpr_operations();
     
     run_test_type_aliases();
     
+    run_test_line_reader();
+    run_test_csv_reader();
+    
     run_test_empty_string_operations();
     run_test_full_capacity();
     run_test_special_characters();
@@ -0,0 +1,199 @@
+#!/usr/bin/env python3
+"""Generate include/zuu/str/unicode_case_tables.hpp from the Unicode
+Character Database.
+
+Simple (1:1) case mappings and simple case folding (status C and S) are
+stored as code point deltas in a two-stage table:
+
+    record = records[stage2[(stage1[cp >> SHIFT] << SHIFT) | (cp & MASK)]]
+
+Identical blocks of stage 2 are shared, and the block size is chosen to
+minimise the total table size. Code points at or above `limit` have no
+case mapping.
+
+Sources (either one):
+    --ucd DIR      UnicodeData.txt and CaseFolding.txt from
+                   https://www.unicode.org/Public/<version>/ucd/
+    --unicore DIR  Perl's lib/unicore (To/Lc.pl, Uc.pl, Tc.pl, Cf.pl and
+                   version), present wherever perl is installed
+
+Usage:
+    python3 tools/gen_case_tables.py --ucd path/to/ucd
+    python3 tools/gen_case_tables.py --unicore /usr/share/perl/5.36.0/unicore
+"""
+
+import argparse
+import os
+import re
+import sys
+
+MAX_CP = 0x110000
+FIELDS = ("lower", "upper", "title", "fold")
+
+
+def read_ucd(path):
+    maps = {f: {} for f in FIELDS}
+    with open(os.path.join(path, "UnicodeData.txt"), encoding="utf-8") as f:
+        for line in f:
+            p = line.rstrip("\n").split(";")
+            cp = int(p[0], 16)
+            upper, lower, title = p[12], p[13], p[14]
+            if upper:
+                maps["upper"][cp] = int(upper, 16)
+            if lower:
+                maps["lower"][cp] = int(lower, 16)
+            # An empty titlecase field means "same as uppercase"
+            if title or upper:
+                maps["title"][cp] = int(title or upper, 16)
+    with open(os.path.join(path, "CaseFolding.txt"), encoding="utf-8") as f:
+        for line in f:
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            code, status, mapping = [x.strip() for x in line.split(";")[:3]]
+            if status in ("C", "S"):
+                maps["fold"][int(code, 16)] = int(mapping, 16)
+
+    version = "unknown"
+    readme = os.path.join(path, "ReadMe.txt")
+    if os.path.exists(readme):
+        m = re.search(r"Version (\d+\.\d+\.\d+)", open(readme, encoding="utf-8").read())
+        if m:
+            version = m.group(1)
+    return maps, version
+
+
+def read_unicore(path):
+    files = {"lower": "Lc.pl", "upper": "Uc.pl", "title": "Tc.pl", "fold": "Cf.pl"}
+    maps = {f: {} for f in FIELDS}
+    for field, name in files.items():
+        text = open(os.path.join(path, "To", name), encoding="utf-8").read()
+        body = text.split("return <<'END';\n", 1)[1].split("\nEND\n", 1)[0]
+        for line in body.splitlines():
+            parts = line.split("\t")
+            start = int(parts[0], 16)
+            end = int(parts[1], 16) if parts[1] else start
+            value = int(parts[2], 16)
+            # Format 'ax': a range maps each code point to value + offset
+            for cp in range(start, end + 1):
+                maps[field][cp] = value + (cp - start)
+    version = open(os.path.join(path, "version"), encoding="utf-8").read().strip()
+    return maps, version
+
+
+def build(maps):
+    limit = max(max(m) for m in maps.values()) + 1
+
+    records = [(0, 0, 0, 0)]
+    index = {records[0]: 0}
+    per_cp = []
+    for cp in range(limit):
+        rec = tuple(maps[f].get(cp, cp) - cp for f in FIELDS)
+        if rec not in index:
+            index[rec] = len(records)
+            records.append(rec)
+        per_cp.append(index[rec])
+
+    best = None
+    for shift in range(4, 10):
+        size = 1 << shift
+        padded = per_cp + [0] * (-len(per_cp) % size)
+        blocks, stage1, seen = [], [], {}
+        for b in range(0, len(padded), size):
+            block = tuple(padded[b:b + size])
+            if block not in seen:
+                seen[block] = len(blocks)
+                blocks.append(block)
+            stage1.append(seen[block])
+        s1_bytes = 1 if len(blocks) <= 256 else 2
+        s2_bytes = 1 if len(records) <= 256 else 2
+        total = len(stage1) * s1_bytes + len(blocks) * size * s2_bytes
+        if best is None or total < best[0]:
+            best = (total, shift, stage1, blocks)
+
+    total, shift, stage1, blocks = best
+    limit = len(stage1) << shift
+    return records, shift, stage1, [x for b in blocks for x in b], limit, total
+
+
+def c_array(values, per_line=24):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def uint_type(values):
+    return "std::uint8_t" if max(values) < 256 else "std::uint16_t"
+
+
+def emit(out, version, records, shift, stage1, stage2, limit, total):
+    record_lines = "\n".join(
+        "    {%d, %d, %d, %d}," % rec for rec in records)
+    text = f"""#pragma once
+
+/**
+ * @file zuu/str/unicode_case_tables.hpp
+ * @brief Unicode simple case mapping and folding tables (generated)
+ * @version 3.0.0
+ *
+ * Generated by tools/gen_case_tables.py from Unicode {version}; do not edit.
+ * Two-stage lookup of code point deltas: {len(stage1)} stage-1 entries,
+ * {len(stage2) >> shift} shared {1 << shift}-entry blocks, {len(records)} distinct
+ * records ({total} bytes of index).
+ */
+
+#include <cstdint>
+
+namespace zuu::detail::unicode_case {{
+
+inline constexpr const char* unicode_version = "{version}";
+
+// Code points at or above `limit` map to themselves
+inline constexpr char32_t limit = 0x{limit:X};
+inline constexpr unsigned shift = {shift};
+
+struct record {{
+    std::int32_t lower;
+    std::int32_t upper;
+    std::int32_t title;
+    std::int32_t fold;
+}};
+
+inline constexpr record records[] = {{
+{record_lines}
+}};
+
+inline constexpr {uint_type(stage1)} stage1[] = {{
+{c_array(stage1)}
+}};
+
+inline constexpr {uint_type(stage2)} stage2[] = {{
+{c_array(stage2)}
+}};
+
+}} // namespace zuu::detail::unicode_case
+"""
+    with open(out, "w", encoding="utf-8", newline="\n") as f:
+        f.write(text)
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--ucd", help="directory with UnicodeData.txt and CaseFolding.txt")
+    source.add_argument("--unicore", help="Perl lib/unicore directory")
+    parser.add_argument("-o", "--output",
+                        default=os.path.join(here, "..", "include", "zuu", "str", "unicode_case_tables.hpp"))
+    args = parser.parse_args()
+
+    maps, version = read_ucd(args.ucd) if args.ucd else read_unicore(args.unicore)
+    records, shift, stage1, stage2, limit, total = build(maps)
+    emit(args.output, version, records, shift, stage1, stage2, limit, total)
+    print(f"{args.output}: Unicode {version}, {len(records)} records, "
+          f"block {1 << shift}, {total} bytes of index", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+"""Generate include/zuu/fmt/pow10_table.hpp: 128-bit significands of
+powers of ten for the floating-point formatter and parser.
+
+Entry k holds floor(10^k * 2^(127 - floor(log2(10^k)))), the leading 128
+bits of 10^k with the top bit set. The range covers every power the
+shortest-digit search needs for binary32 and binary64 (-floor(log10(2^q))
+and -floor(log10(3/4 * 2^q)) over all exponents q) and every power the
+Eisel-Lemire parser needs: w * 10^k with w < 10^19 is below half the
+smallest subnormal for k < -342 and above the largest double for k > 308.
+
+Usage:
+    python3 tools/gen_pow10_table.py
+"""
+
+import argparse
+import os
+import sys
+from fractions import Fraction
+
+
+def floor_log2(x):
+    # floor(log2(x)) for a positive Fraction
+    e = x.numerator.bit_length() - x.denominator.bit_length()
+    if Fraction(2) ** e > x:
+        e -= 1
+    elif Fraction(2) ** (e + 1) <= x:
+        e += 1
+    return e
+
+
+def significand(k):
+    x = Fraction(10) ** k
+    e = floor_log2(x)
+    v = x * Fraction(2) ** (127 - e)
+    return v.numerator // v.denominator, v.denominator == 1
+
+
+def exponent_range():
+    ks = set()
+    # binary64 (q in [-1074, 971]) covers binary32 (q in [-149, 104])
+    for q in range(-1074, 972):
+        ks.add(-((q * 315653) >> 20))
+        ks.add(-((q * 315653 - 131237) >> 20))
+    return min(min(ks), -342), max(max(ks), 308)
+
+
+def emit(out, lo, hi):
+    rows = []
+    exact = []
+    for k in range(lo, hi + 1):
+        v, is_exact = significand(k)
+        if is_exact:
+            exact.append(k)
+        rows.append("    {0x%016Xull, 0x%016Xull}, // 1e%d" % (v >> 64, v & (2 ** 64 - 1), k))
+    body = "\n".join(rows)
+    text = f"""#pragma once
+
+/**
+ * @file zuu/fmt/pow10_table.hpp
+ * @brief 128-bit significands of powers of ten (generated)
+ * @version 3.0.0
+ *
+ * Generated by tools/gen_pow10_table.py; do not edit.
+ * table[k - min_exponent] = floor(10^k * 2^(127 - floor(log2(10^k)))),
+ * the leading 128 bits of 10^k, for k in [{lo}, {hi}]. Entries for
+ * k in [{exact[0]}, {exact[-1]}] are exact.
+ */
+
+#include <cstdint>
+
+namespace zuu::detail::pow10 {{
+
+inline constexpr int min_exponent = {lo};
+inline constexpr int max_exponent = {hi};
+
+struct entry {{
+    std::uint64_t hi;
+    std::uint64_t lo;
+}};
+
+inline constexpr entry table[] = {{
+{body}
+}};
+
+}} // namespace zuu::detail::pow10
+"""
+    with open(out, "w", encoding="utf-8", newline="\n") as f:
+        f.write(text)
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("-o", "--output",
+                        default=os.path.join(here, "..", "include", "zuu", "fmt", "pow10_table.hpp"))
+    args = parser.parse_args()
+
+    lo, hi = exponent_range()
+    emit(args.output, lo, hi)
+    print(f"{args.output}: 1e{lo} .. 1e{hi}, {hi - lo + 1} entries", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()